@@ -0,0 +1,85 @@
+#include <Arduino.h>
+
+#include <AlarmStation/AlarmStation.h>
+
+#include "../Common/ArduinoBuzzer.h"
+
+/**
+ * <br/>
+ * Prints, once after reset, the cost of each alarm storage on the target:
+ * <tt>sizeof</tt> the storage (without heap elements), free RAM with every code pending,
+ * microseconds per raise / clear pair and per iteration over the pending alarms.<br/>
+ * The buzzer is never switched, nothing needs to be connected.
+ */
+static AlarmCode const codes[] = {
+        AlarmCode::SystemMaxTemperatureReached,
+        AlarmCode::WaterMaxTemperatureReached,
+        AlarmCode::AmbientMaxHumidityReached,
+        AlarmCode::AtoTopOffFailed,
+        AlarmCode::AtoReservoirLow,
+        AlarmCode::AtoHighLevel,
+        AlarmCode::Ato2LowLevel,
+        AlarmCode::Ato4LowLevel,
+};
+
+static uint8_t const codeCount = sizeof(codes) / sizeof(codes[0]);
+static uint16_t const rounds = 500;
+
+ArduinoBuzzer buzzer(2);
+static LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> alarmNotifyConfigurations{};
+
+/* warn: Arduino specific, distance between the heap end and the stack */
+static int freeRam() {
+    extern int __heap_start, *__brkval;
+    int top;
+    return (int) &top - (__brkval == 0 ? (int) &__heap_start : (int) __brkval);
+}
+
+template<typename S>
+static void benchmark(char const *name) {
+    BasicAlarmStation<S> alarmStation{buzzer, alarmNotifyConfigurations};
+    AbstractAlarmStation &station = alarmStation;
+
+    uint32_t startUs = micros();
+    for (uint16_t round = 0; round < rounds; ++round) {
+        for (uint8_t index = 0; index < codeCount; ++index) {
+            station.raiseAlarm(codes[index], static_cast<AlarmSeverity>(index % 4));
+            station.clearAlarm(codes[index]);
+        }
+    }
+    uint32_t raiseClearUs = micros() - startUs;
+
+    for (uint8_t index = 0; index < codeCount; ++index) {
+        station.raiseAlarm(codes[index], static_cast<AlarmSeverity>(index % 4));
+    }
+    volatile uint16_t pendingCount = 0;
+    startUs = micros();
+    for (uint16_t round = 0; round < rounds; ++round) {
+        alarmStation.alarmList.forEachPending([&pendingCount](AlarmCode const, AlarmSeverity const, uint32_t const) {
+            pendingCount = pendingCount + 1;
+        });
+    }
+    uint32_t iterateUs = micros() - startUs;
+
+    Serial.print(name);
+    Serial.print(F("\tsizeof: "));
+    Serial.print(sizeof(alarmStation.alarmList));
+    Serial.print(F("\tfree RAM: "));
+    Serial.print(freeRam());
+    Serial.print(F("\traise + clear us x100: "));
+    Serial.print(raiseClearUs * 100 / (static_cast<uint32_t>(rounds) * codeCount));
+    Serial.print(F("\titerate pending us x100: "));
+    Serial.println(iterateUs * 100 / rounds);
+}
+
+void setup() {
+    Serial.begin(9600);
+    Serial.print(F("free RAM: "));
+    Serial.println(freeRam());
+    benchmark<AlarmList>("AlarmList");
+    benchmark<AlarmArray<ALARM_CODE_COUNT>>("AlarmArray");
+}
+
+void loop() {
+    // pass
+}
@@ -3,33 +3,59 @@
 #pragma once
 
 #include <Abstract/AbstractRunnable.h>
+#include <Common/Centi.h>
+#include <Common/DhtFrameDecoder.h>
 #include <Common/Sensor.h>
+#include <Enums/DhtModel.h>
+#include <Enums/DhtReadStatus.h>
 #include <Enums/TemperatureUnit.h>
 
 /**
  * DHT22 and AM2302 often have a pull-up already inside, but it doesn't hurt to add another one!
  */
 
-enum class DhtModel : uint8_t {
-    Dht11 = 11,
-    Dht12 = 12,
-    Dht21 = 21,
-    Dht22 = 22,
-    Am2301 = 21,
-    Am2302 = 22,
-};
-
+/**
+ * <br/>
+ * Non-blocking DHT driver.<br/>
+ * The 40-bit frame is captured by the external interrupt of <tt>McuPin</tt>, every falling edge is time stamped,
+ * decoding is done afterwards in the loop by <tt>DhtFrameDecoder</tt>.<br/>
+ * Loop states: <tt>Idle</tt> -> <tt>StartSignal</tt> (line held low, 20 ms DHT11 / DHT12, 2 ms others) -> <tt>Capturing</tt> (~5 ms)
+ * -> decode and update sensors -> <tt>Idle</tt>.<br/>
+ * Each loop call costs a few microseconds, interrupts are never disabled.<br/>
+ * Failed reads are reported with <tt>Sensor::setError()</tt>.
+ *
+ * @tparam McuPin – micro-controller pin where the sensor is attached, must support <tt>attachInterrupt()</tt> (Nano: 2, 3)
+ */
+template<uint8_t McuPin>
 class ArduinoDhtHub :
         public AbstractRunnable {
 
 private:
 
-    DHT dht;
-    Sensor<float> &temperatureSensor;
-    Sensor<float> &humiditySensor;
+    enum class DhtHubState : uint8_t {
+        Idle,
+        StartSignal,
+        Capturing,
+    };
+
+    static DhtFrameDecoder decoder;
+
+    static void onFallingEdge() {
+        decoder.onFallingEdge(static_cast<uint16_t>(micros()));
+    }
+
+    const DhtModel dhtModel;
+    Sensor<Centi> &temperatureSensor;
+    Sensor<Centi> &humiditySensor;
     const TemperatureUnit temperatureUnit;
-    static constexpr uint32_t delayMs = 2200; // <- average response time is 2 seconds
+    static constexpr uint32_t delayMs = 2200;      // <- sensor sampling period is 2 seconds
+    const uint8_t startSignalMs;                   // <- host start signal, DHT11 / DHT12 ≥ 18 ms low, DHT21 / DHT22 1 .. 10 ms
+    static constexpr uint32_t captureTimeoutMs = 10;
+    DhtHubState state = DhtHubState::Idle;
+    DhtReadStatus lastReadStatus = DhtReadStatus::NoResponse;
+    uint32_t stateStartMs = 0;
     uint32_t delayStartMs = 0;
+    bool hasRead = false;
 
 public:
 
@@ -37,56 +63,95 @@ public:
      * <br/>
      * Hub handling the retrieval of temperature and humidity data from the DHT sensor.
      *
-     * @param mcuPin – micro-controller pin where the sensor is attached
      * @param dhtModel – model of the DHT sensor
-     * @param temperatureUnit – flag to call appropriate methods
      * @param outTemperatureSensor – sensor reference whose reading will be updated
      * @param outHumiditySensor  – sensor reference whose reading will be updated
+     * @param temperatureUnit – flag to convert the temperature reading
      */
     ArduinoDhtHub(
-            const uint8_t mcuPin,
             const DhtModel dhtModel,
-            Sensor<float> &outTemperatureSensor,
-            Sensor<float> &outHumiditySensor,
+            Sensor<Centi> &outTemperatureSensor,
+            Sensor<Centi> &outHumiditySensor,
             TemperatureUnit temperatureUnit
     ) :
-            dht(mcuPin, static_cast<uint8_t>(dhtModel)),
+            dhtModel(dhtModel),
             temperatureSensor(outTemperatureSensor),
             humiditySensor(outHumiditySensor),
-            temperatureUnit(temperatureUnit) {}
+            temperatureUnit(temperatureUnit),
+            startSignalMs(dhtModel == DhtModel::Dht11 || dhtModel == DhtModel::Dht12 ? 20 : 2) {}
+
+    DhtReadStatus getLastReadStatus() const {
+        return lastReadStatus;
+    }
 
     void setup() override {
-        dht.begin();
+        pinMode(McuPin, INPUT_PULLUP);
     }
 
     void loop() override {
-        if (delayStartMs == 0 || millis() - delayStartMs > delayMs) {
-
-            float f = NAN;
-
-            f = dht.readHumidity();
-            if (f != NAN) {
-                humiditySensor.setReading(f);
-            } else {
-                humiditySensor.setReading(-54.0f);
-            }
-
-            f = NAN;
-
-            if (temperatureUnit == TemperatureUnit::Celsius) {
-                f = dht.readTemperature();
-            } else {
-                f = dht.readTemperature(true);
-            }
-            if (f != NAN) {
-                temperatureSensor.setReading(f);
-            } else {
-                temperatureSensor.setReading(-54.0f);
-            }
-
-            delayStartMs = millis();
+        switch (state) {
+
+            case DhtHubState::Idle:
+                if (!hasRead || millis() - delayStartMs > delayMs) {
+                    delayStartMs = millis();
+                    hasRead = true;
+                    /* host start signal */
+                    pinMode(McuPin, OUTPUT);
+                    digitalWrite(McuPin, LOW);
+                    ArduinoDhtHub::setState(DhtHubState::StartSignal);
+                }
+                break;
+
+            case DhtHubState::StartSignal:
+                if (millis() - stateStartMs >= startSignalMs) {
+                    /* a falling edge latched while driving the line low fires right away, reset after attaching */
+                    attachInterrupt(digitalPinToInterrupt(McuPin), ArduinoDhtHub::onFallingEdge, FALLING);
+                    decoder.reset();
+                    pinMode(McuPin, INPUT_PULLUP);
+                    ArduinoDhtHub::setState(DhtHubState::Capturing);
+                }
+                break;
+
+            case DhtHubState::Capturing:
+                if (decoder.isComplete() || millis() - stateStartMs > captureTimeoutMs) {
+                    detachInterrupt(digitalPinToInterrupt(McuPin));
+                    ArduinoDhtHub::updateSensors(decoder.decode());
+                    ArduinoDhtHub::setState(DhtHubState::Idle);
+                }
+                break;
+        }
+    }
+
+private:
+
+    void setState(DhtHubState const newState) {
+        state = newState;
+        stateStartMs = millis();
+    }
+
+    void updateSensors(DhtReadStatus const readStatus) {
+        lastReadStatus = readStatus;
+
+        if (readStatus != DhtReadStatus::Ok) {
+#ifdef __SERIAL_DEBUG__
+            Serial << "DHT read failed: " << static_cast<int>(readStatus) << "\n";
+#endif
+            humiditySensor.setError();
+            temperatureSensor.setError();
+            return;
         }
+
+        humiditySensor.setReading(Centi::fromRaw(static_cast<int16_t>(decoder.getHumidityDeci(dhtModel) * 10)));
+
+        int16_t centiTemperature = static_cast<int16_t>(decoder.getTemperatureDeci(dhtModel) * 10);
+        if (temperatureUnit == TemperatureUnit::Fahrenheit) {
+            centiTemperature = static_cast<int16_t>(static_cast<int32_t>(centiTemperature) * 9 / 5 + 3200);
+        }
+        temperatureSensor.setReading(Centi::fromRaw(centiTemperature));
     }
 };
 
-#endif
\ No newline at end of file
+template<uint8_t McuPin>
+DhtFrameDecoder ArduinoDhtHub<McuPin>::decoder{};
+
+#endif
@@ -3,6 +3,8 @@
 #pragma once
 
 #include <Abstract/AbstractRunnable.h>
+#include <Common/Centi.h>
+#include <Common/Sensor.h>
 #include <Enums/TemperatureUnit.h>
 
 enum class DsResolutionBits : uint8_t {
@@ -12,6 +14,34 @@ enum class DsResolutionBits : uint8_t {
     _12 = 12,
 };
 
+/**
+ * <br/>
+ * Compile-time probe table entry.
+ * \code
+ *     const DsProbe dsProbes[] = {
+ *             {{0x28, 0xFF, 0x4C, 0x8A, 0x52, 0x16, 0x04, 0x3D}, DsResolutionBits::__9, &waterTemperatureSensor},
+ *             {{0x28, 0xFF, 0x1B, 0x7C, 0x52, 0x16, 0x04, 0x8E}, DsResolutionBits::_12, &systemTemperatureSensor},
+ *     };
+ * \endcode
+ */
+struct DsProbe {
+    DeviceAddress address;
+    DsResolutionBits resolutionBits;
+    Sensor<Centi> *pSensor;
+};
+
+/**
+ * <br/>
+ * Conversion schedule of a single probe.
+ */
+struct DsProbeSlot {
+    uint16_t conversionMs = 750;
+    uint32_t conversionStartMs = 0;
+    bool converting = false;
+    bool addressValid = false;  // <- CRC and family code, checked once
+    bool valid = false;         // <- address valid and the probe answered
+};
+
 /**
  * <br/>
  * <a href="https://datasheets.maximintegrated.com/en/ds/DS18B20.pdf">DS18B20 - Programmable Resolution 1-Wire Digital Thermometer</a><br/>
@@ -22,68 +52,60 @@ enum class DsResolutionBits : uint8_t {
  * <tt>• 10-bit resolution => 187.5 ms</tt><br/>
  * <tt>• 11-bit resolution => 375 ms</tt><br/>
  * <tt>• 12-bit resolution => 750 ms</tt><br/>
+ * <br/>
+ * Probes are given as a fixed table of <tt>DsProbe</tt>, addresses are validated once in <tt>setup()</tt>
+ * (CRC, DS18B20 family code), missing or failing probes are reported as sensor errors and skipped.<br/>
+ * A missing probe is looked for again when the round-robin reaches it, at most one every <tt>reconnectIntervalMs</tt>,
+ * so a probe plugged in late or back after a bus fault is set up and read without a reset.<br/>
+ * Every probe has its own conversion deadline depending on its resolution.<br/>
+ * Each <tt>loop()</tt> does at most one bus transaction: a probe whose conversion is complete is read first,
+ * otherwise the next idle probe (round-robin) is sent an addressed conversion request.<br/>
+ * Fast 9-bit probes are therefore not held back by slow 12-bit ones.<br/>
+ * In parasite power mode the bus is held high during conversion, only one probe converts at a time.
+ *
+ * @tparam N – number of probes in the table
  */
+template<uint8_t N>
 class ArduinoDsTemperatureSensorsHub :
         public AbstractRunnable {
 
 private:
 
+    static constexpr uint8_t ds18b20FamilyCode = 0x28;
+    static constexpr uint16_t reconnectIntervalMs = 10000;
+
     DallasTemperature sensors;
-    const DsResolutionBits globalDsResolutionBits;
-    LinkedMap<DeviceAddress *, DsResolutionBits> *addressToResolutionMap;
-    LinkedMap<DeviceAddress *, Sensor<float> *> *addressToOutSensorMap;
+    DsProbe const (&probes)[N];
+    DsProbeSlot slots[N];
     TemperatureUnit temperatureUnit = TemperatureUnit::Celsius;
-    uint16_t waitForConversionMs = 750;
-    uint32_t waitForConversionStartMs = 0;
+    uint8_t requestIndex = 0;
+    uint8_t convertingCount = 0;
+    uint32_t reconnectMs = 0;
+    bool parasitePower = false;
 
 public:
 
     /**
      * <br/>
-     * All mapped sensors readings will be updated with precision and speed depending on specified resolution bits.<br/>
-     * All sensor readings depend on specified temperature measurement unit.<br/>
-     *
-     * @param pOneWire – pointer/address to instance of <tt>OneWire</tt>
-     * @param globalDsResolutionBits – affects reading precision and speed for all sensors
-     * @param addressToOutSensorMap – map of DS18B20 unique 64-bit serial code and <tt>Sensor</tt> instance
-     * @param temperatureUnit – flag to call appropriate conversion methods
-     */
-    ArduinoDsTemperatureSensorsHub(
-            OneWire *pOneWire,
-            const DsResolutionBits globalDsResolutionBits,
-            LinkedMap<DeviceAddress *, Sensor<float> *> *addressToOutSensorMap,
-            TemperatureUnit temperatureUnit
-    ) :
-            sensors(pOneWire),
-            globalDsResolutionBits(globalDsResolutionBits),
-            addressToResolutionMap(nullptr),
-            addressToOutSensorMap(addressToOutSensorMap),
-            temperatureUnit(temperatureUnit),
-            waitForConversionMs(sensors.millisToWaitForConversion(static_cast<uint8_t>(globalDsResolutionBits))) {};
-
-    /**
-     * <br/>
-     * Mapped sensor reading will be updated with precision depending on mapped resolution bits for each address.<br/>
-     * All sensor reading speed will be the same, it's the speed of the slowest sensor with greatest precision/resolution.<br/>
+     * Every probe reading will be updated with precision and speed depending on its resolution bits.<br/>
      * All sensor readings depend on specified temperature measurement unit.
      *
      * @param pOneWire – pointer/address to instance of <tt>OneWire</tt>
-     * @param addressToResolutionMap – map of DS18B20 unique 64-bit serial code and resolution bits
-     * @param addressToOutSensorMap – map of DS18B20 unique 64-bit serial code and <tt>Sensor</tt> instance
+     * @param probes – table of DS18B20 unique 64-bit serial code, resolution bits and <tt>Sensor</tt> instance
      * @param temperatureUnit – flag to call appropriate conversion methods
      */
     ArduinoDsTemperatureSensorsHub(
             OneWire *pOneWire,
-            LinkedMap<DeviceAddress *, DsResolutionBits> *addressToResolutionMap,
-            LinkedMap<DeviceAddress *, Sensor<float> *> *addressToOutSensorMap,
+            DsProbe const (&probes)[N],
             TemperatureUnit temperatureUnit
     ) :
             sensors(pOneWire),
-            globalDsResolutionBits(DsResolutionBits::__9),
-            addressToResolutionMap(addressToResolutionMap),
-            addressToOutSensorMap(addressToOutSensorMap),
+            probes(probes),
+            slots{},
             temperatureUnit(temperatureUnit) {};
 
+    ~ArduinoDsTemperatureSensorsHub() override = default;
+
     void setup() override {
         sensors.begin();
         delay(999);
@@ -92,56 +114,103 @@ public:
 #endif
         /* Disable blocking wait for conversion, go to ASYNC mode */
         sensors.setWaitForConversion(false);
+        parasitePower = sensors.isParasitePowerMode();
+
+        /* Validate the table once, the loop trusts the addresses */
+        for (uint8_t index = 0; index < N; ++index) {
+            DsProbe const &probe = probes[index];
+            slots[index].addressValid = OneWire::crc8(probe.address, 7) == probe.address[7] &&
+                                        probe.address[0] == ds18b20FamilyCode;
+            ArduinoDsTemperatureSensorsHub::connectProbe(index);
+        }
+        reconnectMs = millis();
+    }
 
-        if (addressToResolutionMap != nullptr) {
-            /* Set individual resolution if specified */
-
-            uint8_t greatestResolution = static_cast<uint8_t>(globalDsResolutionBits);
-
-            MapIterator<DeviceAddress *, DsResolutionBits> const &mapIterator = addressToResolutionMap->iterator();
-
-            while (mapIterator.hasNext()) {
-                KeyValue<DeviceAddress *, DsResolutionBits> *pKeyValue = mapIterator.next();
-                DeviceAddress *pDeviceAddress = pKeyValue->getKey();
-                uint8_t mappedDeviceResolution = static_cast<uint8_t>(pKeyValue->getValue());
-
-                sensors.setResolution(*pDeviceAddress, mappedDeviceResolution);
+    void loop() override {
+        /* read the first probe whose conversion is complete */
+        uint32_t nowMs = millis();
+        for (uint8_t index = 0; index < N; ++index) {
+            DsProbeSlot &slot = slots[index];
+            if (slot.converting && nowMs - slot.conversionStartMs >= slot.conversionMs) {
+                ArduinoDsTemperatureSensorsHub::readProbe(index);
+                return;
+            }
+        }
 
-                /* figure out the greatest used resolution */
-                if (mappedDeviceResolution > greatestResolution) {
-                    greatestResolution = mappedDeviceResolution;
-                }
+        /* otherwise start the next idle probe, round-robin */
+        if (parasitePower && convertingCount > 0) {
+            return;
+        }
+        for (uint8_t attempt = 0; attempt < N; ++attempt) {
+            uint8_t index = requestIndex;
+            requestIndex = static_cast<uint8_t>(requestIndex + 1 == N ? 0 : requestIndex + 1);
+            DsProbeSlot &slot = slots[index];
+            if (slot.valid && !slot.converting) {
+                ArduinoDsTemperatureSensorsHub::requestProbe(index);
+                return;
+            }
+            if (!slot.valid && slot.addressValid && nowMs - reconnectMs >= reconnectIntervalMs) {
+                reconnectMs = nowMs;
+                ArduinoDsTemperatureSensorsHub::connectProbe(index);
+                return;
             }
+        }
+    }
 
-            waitForConversionMs = sensors.millisToWaitForConversion(greatestResolution);
+private:
 
+    /**
+     * <br/>
+     * Looks for the probe on the bus and sets its resolution, a probe back after a power loss has its default one.
+     */
+    void connectProbe(uint8_t const index) {
+        DsProbe const &probe = probes[index];
+        DsProbeSlot &slot = slots[index];
+
+        slot.valid = slot.addressValid && sensors.isConnected(probe.address);
+        if (slot.valid) {
+            uint8_t resolutionBits = static_cast<uint8_t>(probe.resolutionBits);
+            sensors.setResolution(probe.address, resolutionBits);
+            slot.conversionMs = sensors.millisToWaitForConversion(resolutionBits);
         } else {
-            /* Set global resolution for ALL sensors. */
-            /* Note, this also affects sensors that are not specified in the 'addressToOutSensorMap' */
-            sensors.setResolution(static_cast<uint8_t>(globalDsResolutionBits));
+#ifdef __SERIAL_DEBUG__
+            Serial << "DS probe " << static_cast<int>(index) << " invalid or missing\n";
+#endif
+            probe.pSensor->setError();
         }
     }
 
-    void loop() override {
-        if (waitForConversionStartMs == 0 || millis() - waitForConversionStartMs > waitForConversionMs) {
-
-            MapIterator<DeviceAddress *, Sensor<float> *> const &mapIterator = addressToOutSensorMap->iterator();
+    void requestProbe(uint8_t const index) {
+        DsProbeSlot &slot = slots[index];
+        if (sensors.requestTemperaturesByAddress(probes[index].address)) {
+            slot.conversionStartMs = millis();
+            slot.converting = true;
+            ++convertingCount;
+        } else {
+            /* probe did not answer, looked for again by the round-robin */
+            slot.valid = false;
+            probes[index].pSensor->setError();
+        }
+    }
 
-            while (mapIterator.hasNext()) {
-                KeyValue<DeviceAddress *, Sensor<float> *> *pKeyValue = mapIterator.next();
-                DeviceAddress *pDeviceAddress = pKeyValue->getKey();
-                Sensor<float> *pSensor = pKeyValue->getValue();
+    void readProbe(uint8_t const index) {
+        slots[index].converting = false;
+        --convertingCount;
 
-                /* Update sensor readings */
-                if (temperatureUnit == TemperatureUnit::Celsius) {
-                    pSensor->setReading(sensors.getTempC(*pDeviceAddress)); // <- getTempC(...)
-                } else {
-                    pSensor->setReading(sensors.getTempF(*pDeviceAddress)); // <- getTempF(...)
-                }
+        /* Update sensor readings, disconnected probe or CRC failure reads as DEVICE_DISCONNECTED_RAW */
+        Sensor<Centi> *pSensor = probes[index].pSensor;
+        int16_t raw = sensors.getTemp(probes[index].address);
+        if (raw == DEVICE_DISCONNECTED_RAW) {
+            slots[index].valid = false;
+            pSensor->setError();
+        } else {
+            /* raw is 1/128 °C, convert to hundredths without float */
+            int32_t centiCelsius = (static_cast<int32_t>(raw) * 25 + (raw < 0 ? -16 : 16)) / 32;
+            if (temperatureUnit == TemperatureUnit::Fahrenheit) {
+                pSensor->setReading(Centi::fromRaw(static_cast<int16_t>(centiCelsius * 9 / 5 + 3200)));
+            } else {
+                pSensor->setReading(Centi::fromRaw(static_cast<int16_t>(centiCelsius)));
             }
-
-            sensors.requestTemperatures();
-            waitForConversionStartMs = millis();
         }
     }
 };
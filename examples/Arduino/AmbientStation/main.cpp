@@ -26,9 +26,16 @@
 #endif
 
 #include <AmbientStation/AmbientStation.h>
-#include <Common/CountDown.h>
+#include <AlarmStation/AlarmStation.h>
+#include <AmbientStation/AmbientRule.h>
+#include <AmbientStation/AmbientHumiditySensorConnection.h>
+#include <AmbientStation/AmbientTemperatureSensorConnection.h>
+#include <AmbientStation/PidHeaterController.h>
+#include <AmbientStation/SystemTemperatureSensorConnection.h>
+#include <AmbientStation/WaterTemperatureSensorConnection.h>
+#include <Common/Centi.h>
 #include <Common/LinkedMap.h>
-#include <Common/RunnableFunction.h>
+#include <Common/PidController.h>
 #include <Common/Sensor.h>
 
 #include "../Common/ArduinoBuzzer.h"
@@ -76,156 +83,55 @@ ArduinoSwitchable waterCooler{McuPin::WaterCooler};
 ArduinoSwitchable waterHeater{McuPin::WaterHeater};
 
 /**
- * Create appropriate temperature and humidity sensors.
- * Remove/Comment not implemented hardware.
+ * Create ambient station.
  */
-Sensor<float> ambientHumiditySensor{-100.0f};
-Sensor<float> ambientTemperatureSensor{-100.0f};
-Sensor<float> systemTemperatureSensor{-100.0f};
-Sensor<float> waterTemperatureSensor{-100.0f};
+AmbientStation ambientStation{};
 
 /**
- * Create ambient station.
+ * Create appropriate temperature and humidity sensors, connected to the ambient station.
+ * Remove/Comment not implemented hardware.
  */
-static AmbientSettings ambientSettings{
-        24.2,
-        25.4,
-        42,
-        32,
-        66,
-        true,
-        true
-};
+AmbientHumiditySensorConnection<AmbientStation, Centi> ambientHumidityConnection{ambientStation};
+AmbientTemperatureSensorConnection<AmbientStation, Centi> ambientTemperatureConnection{ambientStation};
+SystemTemperatureSensorConnection<AmbientStation, Centi> systemTemperatureConnection{ambientStation};
+WaterTemperatureSensorConnection<AmbientStation, Centi> waterTemperatureConnection{ambientStation};
+
+constexpr uint32_t sensorMaxAgeMs = 10 * 1000ul; // <- readings older than this are stale, rules fail safe off
+Sensor<Centi> ambientHumiditySensor{&ambientHumidityConnection, Centi::fromWhole(-100), sensorMaxAgeMs};
+Sensor<Centi> ambientTemperatureSensor{&ambientTemperatureConnection, Centi::fromWhole(-100), sensorMaxAgeMs};
+Sensor<Centi> systemTemperatureSensor{&systemTemperatureConnection, Centi::fromWhole(-100), sensorMaxAgeMs};
+Sensor<Centi> waterTemperatureSensor{&waterTemperatureConnection, Centi::fromWhole(-100), sensorMaxAgeMs};
 
 /**
  * <br/>
- * <tt>RunnableGlobalFunction</tt> which will be executed by <tt>AbstractRunnable::loopAll();</tt>
+ * Water heater, PID with a 10 min time-proportional window, at most 288 relay switches a day.<br/>
+ * Gains of a 60 L tank with a 100 W heater, call <tt>startAutotune</tt> once on the real tank and keep the result.
  */
+PidHeaterController<Sensor<Centi>, ArduinoSwitchable> waterHeaterController{
+        waterTemperatureSensor, waterHeater, Centi::fromFloat(24.4f), PidGains{8148, 4310, 3850}};
 
-constexpr uint32_t delayMs = 30 * 1000ul;
-CountDown ambientFanCountDown{};
-RunnableFunction ambientFanRules{[]() -> void {
-    /* what to do depending on sensors readings */
-    if (ambientFanCountDown.isNotCounting()) {
-        if (ambientHumiditySensor.getReading() >= ambientSettings.startAmbientFanAtHumidity ||
-            ambientTemperatureSensor.getReading() >= ambientSettings.startAmbientFanAtTemperature) {
-            //
-            if (ambientFan.isInState(Switched::Off)) {
-                ambientFan.setState(Switched::On);
-                ambientFanCountDown.start(delayMs);
-            }
-        } else {
-            if (ambientFan.isInState(Switched::On)) {
-                ambientFan.setState(Switched::Off);
-                ambientFanCountDown.start(delayMs);
-            }
-        }
-    }
-
-    /* what to do with alarms */
-    if (ambientHumiditySensor.getReading() > ambientSettings.ambientMaxHumidityAlarmTrigger) {
-        alarmStation.alarmList.add(AlarmCode::AmbientMaxHumidityReached, AlarmSeverity::Minor);
-    } else {
-        alarmStation.alarmList.acknowledge(AlarmCode::AmbientMaxHumidityReached);
-    }
-
-    if (ambientTemperatureSensor.getReading() > ambientSettings.ambientMaxTemperatureAlarmTrigger) {
-        alarmStation.alarmList.add(AlarmCode::AmbientMaxTemperatureReached, AlarmSeverity::Minor);
-    } else {
-        alarmStation.alarmList.acknowledge(AlarmCode::AmbientMaxTemperatureReached);
-    }
-}};
-
-CountDown systemFanCountDown{};
-RunnableFunction systemFanRules{[]() -> void {
-    /* what to do depending on sensors readings */
-    if (systemFanCountDown.isNotCounting()) {
-        if (systemTemperatureSensor.getReading() >= ambientSettings.startSystemFanAtTemperature) {
-            if (systemFan.isInState(Switched::Off)) {
-                systemFan.setState(Switched::On);
-                systemFanCountDown.start(delayMs);
-            }
-        } else {
-            if (systemFan.isInState(Switched::On)) {
-                systemFan.setState(Switched::Off);
-                systemFanCountDown.start(delayMs);
-            }
-        }
-    }
-
-    /* what to do with alarms */
-    if (systemTemperatureSensor.getReading() > ambientSettings.systemMaxTemperatureAlarmTrigger) {
-        alarmStation.alarmList.add(AlarmCode::SystemMaxTemperatureReached, AlarmSeverity::Minor);
-    } else {
-        alarmStation.alarmList.acknowledge(AlarmCode::SystemMaxTemperatureReached);
-    }
-}};
-
-CountDown waterCoolerCountDown{};
-RunnableFunction waterCoolingRules{[]() -> void {
-    /* what to do if disabled */
-    if (!ambientSettings.isWaterCoolingEnabled) {
-        waterCooler.setState(Switched::Off);
-        alarmStation.alarmList.acknowledge(AlarmCode::WaterMaxTemperatureReached);
-        return;
-    }
-
-    /* what to do depending on sensors readings */
-    if (waterCoolerCountDown.isNotCounting()) {
-        if (waterTemperatureSensor.getReading() >= ambientSettings.startWaterCoolingAtTemperature) {
-            if (waterCooler.isInState(Switched::Off)) {
-                waterCooler.setState(Switched::On);
-                waterCoolerCountDown.start(delayMs);
-            }
-        } else {
-            if (waterCooler.isInState(Switched::On)) {
-                waterCooler.setState(Switched::Off);
-                waterCoolerCountDown.start(delayMs);
-            }
-        }
-    }
-
-    /* what to do with alarms */
-    if (waterTemperatureSensor.getReading() > ambientSettings.waterMaxTemperatureAlarmTrigger) {
-        alarmStation.alarmList.add(AlarmCode::WaterMaxTemperatureReached, AlarmSeverity::Major);
-    } else {
-        alarmStation.alarmList.acknowledge(AlarmCode::WaterMaxTemperatureReached);
-    }
-}};
-
-CountDown waterHeaterCountDown{};
-RunnableFunction waterHeatingRules{[]() -> void {
-    /* what to do if disabled */
-    if (!ambientSettings.isWaterHeatingEnabled) {
-        waterHeater.setState(Switched::Off);
-        alarmStation.alarmList.acknowledge(AlarmCode::WaterMinTemperatureReached);
-        return;
-    }
-
-    /* what to do depending on sensors readings */
-    if (waterHeaterCountDown.isNotCounting()) {
-        if (waterTemperatureSensor.getReading() < ambientSettings.stopWaterHeatingAtTemperature) {
-            if (waterHeater.isInState(Switched::Off)) {
-                waterHeater.setState(Switched::On);
-                waterHeaterCountDown.start(delayMs);
-            }
-        } else {
-            if (waterHeater.isInState(Switched::On)) {
-                waterHeater.setState(Switched::Off);
-                waterHeaterCountDown.start(delayMs);
-            }
-        }
-    }
-
-    /* what to do with alarms */
-    if (waterTemperatureSensor.getReading() < ambientSettings.waterMinTemperatureAlarmTrigger &&
-        waterTemperatureSensor.getReading() > -99.0f) {
-        //
-        alarmStation.alarmList.add(AlarmCode::WaterMinTemperatureReached, AlarmSeverity::Major);
-    } else {
-        alarmStation.alarmList.acknowledge(AlarmCode::WaterMinTemperatureReached);
-    }
-}};
+/**
+ * <br/>
+ * Ambient station rules, kept in flash, the water heater is driven by <tt>waterHeaterController</tt>.<br/>
+ * {input, comparator, threshold, hysteresis, actuator, min on [s], min off [s], alarm threshold, alarm code, severity}
+ */
+const AmbientRule ambientRules[] PROGMEM = {
+        {AmbientInput::WaterTemperature, Comparator::Below, Centi::fromWhole(22), Centi(),
+                AmbientActuator::None, 0, 0,
+                Centi::fromWhole(22), AlarmCode::WaterMinTemperatureReached, AlarmSeverity::Major},
+        {AmbientInput::WaterTemperature, Comparator::Above, Centi::fromFloat(25.4f), Centi::fromFloat(0.2f),
+                AmbientActuator::WaterCooler, 30, 30,
+                Centi::fromWhole(28), AlarmCode::WaterMaxTemperatureReached, AlarmSeverity::Major},
+        {AmbientInput::SystemTemperature, Comparator::Above, Centi::fromWhole(42), Centi::fromWhole(1),
+                AmbientActuator::SystemFan, 30, 30,
+                Centi::fromWhole(46), AlarmCode::SystemMaxTemperatureReached, AlarmSeverity::Minor},
+        {AmbientInput::AmbientTemperature, Comparator::Above, Centi::fromWhole(32), Centi::fromWhole(1),
+                AmbientActuator::AmbientFan, 30, 30,
+                Centi::fromWhole(32), AlarmCode::AmbientMaxTemperatureReached, AlarmSeverity::Minor},
+        {AmbientInput::AmbientHumidity, Comparator::Above, Centi::fromWhole(66), Centi::fromWhole(2),
+                AmbientActuator::AmbientFan, 30, 30,
+                Centi::fromWhole(90), AlarmCode::AmbientMaxHumidityReached, AlarmSeverity::Minor},
+};
 
 void setup() {
     /* Disable watchdog timer first thing, in case it is misconfigured */
@@ -258,6 +164,19 @@ void setup() {
     alarmNotifyConfigurations.put(AlarmSeverity::Critical, AlarmNotifyConfiguration(1, 4000));
 #endif
 
+    /**
+     * Wire the rule table, remove/comment not implemented hardware.
+     */
+    ambientStation.setRulesP(ambientRules, sizeof(ambientRules) / sizeof(AmbientRule));
+    ambientStation.attachSensor(AmbientInput::AmbientHumidity, ambientHumiditySensor);
+    ambientStation.attachSensor(AmbientInput::AmbientTemperature, ambientTemperatureSensor);
+    ambientStation.attachSensor(AmbientInput::SystemTemperature, systemTemperatureSensor);
+    ambientStation.attachSensor(AmbientInput::WaterTemperature, waterTemperatureSensor);
+    ambientStation.attachAlarmStation(alarmStation);
+    ambientStation.attachActuator(AmbientActuator::AmbientFan, ambientFan);
+    ambientStation.attachActuator(AmbientActuator::SystemFan, systemFan);
+    ambientStation.attachActuator(AmbientActuator::WaterCooler, waterCooler);
+
     /* Do not edit! */
     AbstractRunnable::setupAll();
 
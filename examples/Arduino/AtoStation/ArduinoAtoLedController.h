@@ -3,33 +3,48 @@
 #pragma once
 
 #include <AtoStation/AtoStation.h>
-#include "../Common/ArduinoBlinkingLed.h"
+#include <Abstract/AbstractPatternSequencer.h>
 
+/**
+ * <br/>
+ * Shows the ATO state on three sequencer channels, the leds themselves are not runnables.<br/>
+ * Several stations can share one sequencer, their blinking stays in phase.
+ */
 class ArduinoAtoLedController : public AbstractRunnable {
 
 private:
 
     AtoStation &atoStation;
+    AbstractPatternSequencer &sequencer;
 
-    ArduinoBlinkingLed redLed;
-    ArduinoBlinkingLed yellowLed;
-    ArduinoBlinkingLed greenLed;
+    uint8_t redLedChannel;
+    uint8_t yellowLedChannel;
+    uint8_t greenLedChannel;
 
     AtoStationState atoStationState = AtoStationState::Invalid;
 
+    void showPatterns(uint32_t const red, uint32_t const yellow, uint32_t const green) {
+        sequencer.setPattern(redLedChannel, red);
+        sequencer.setPattern(yellowLedChannel, yellow);
+        sequencer.setPattern(greenLedChannel, green);
+    }
+
 public:
 
-    ArduinoAtoLedController(AtoStation &atoStationToAttachTo, uint8_t redLedPin, uint8_t yellowLedPin, uint8_t greenLedPin) :
+    ArduinoAtoLedController(
+            AtoStation &atoStationToAttachTo,
+            AbstractPatternSequencer &sequencer,
+            uint8_t const redLedChannel,
+            uint8_t const yellowLedChannel,
+            uint8_t const greenLedChannel
+    ) :
             atoStation(atoStationToAttachTo),
-            redLed{redLedPin},
-            yellowLed{yellowLedPin},
-            greenLed{greenLedPin} {}
-
-    void setup() override {
-        redLed.setup();
-        yellowLed.setup();
-        greenLed.setup();
-    }
+            sequencer(sequencer),
+            redLedChannel(redLedChannel),
+            yellowLedChannel(yellowLedChannel),
+            greenLedChannel(greenLedChannel) {}
+
+    void setup() override {}
 
     void loop() override {
 
@@ -42,36 +57,26 @@ public:
         switch (atoStationState) {
 
             case AtoStationState::Sensing:
-                redLed.setOff();
-                yellowLed.setOff();
-                greenLed.cycleOnOffMs(1820, 680);
+                ArduinoAtoLedController::showPatterns(Pattern::Off, Pattern::Off, Pattern::SlowBlink);
                 break;
 
             case AtoStationState::Dispensing:
-                redLed.setOff();
-                yellowLed.setOff();
-                greenLed.setOn();
+                ArduinoAtoLedController::showPatterns(Pattern::Off, Pattern::Off, Pattern::On);
                 break;
 
             case AtoStationState::Sleeping:
-                redLed.setOff();
-                yellowLed.cycleOnOffMs(1820, 680);
-                greenLed.setOff();
+                ArduinoAtoLedController::showPatterns(Pattern::Off, Pattern::SlowBlink, Pattern::Off);
                 break;
 
             case AtoStationState::Alarming:
-                redLed.cycleOnOffMs(680, 480);
-                yellowLed.setOff();
-                greenLed.setOff();
+                ArduinoAtoLedController::showPatterns(Pattern::FastBlink, Pattern::Off, Pattern::Off);
                 break;
 
             default:
-                redLed.setOn();
-                yellowLed.setOn();
-                greenLed.setOn();
+                ArduinoAtoLedController::showPatterns(Pattern::On, Pattern::On, Pattern::On);
                 break;
         }
     }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,66 @@
+#ifndef _AQUARIUM_CONTROLLER_ARDUINO_ATO_STATION_ARDUINO_ATO_LEVEL_BANK_H_
+#define _AQUARIUM_CONTROLLER_ARDUINO_ATO_STATION_ARDUINO_ATO_LEVEL_BANK_H_
+#pragma once
+
+#include <avr/interrupt.h>
+
+#include <AtoStation/AbstractAtoLevelBank.h>
+
+/**
+ * <br/>
+ * Level sensors of all ATO stations on one 8 bit port, read with a single register access per loop.<br/>
+ * Bit <tt>n</tt> of the bank is pin <tt>n</tt> of the port, e.g. on the Mega <tt>PINF</tt> holds <tt>A0 .. A7</tt>.
+ * Only the pins of <tt>pinMask</tt> are made inputs and read, the other pins of the port keep their configuration.
+ * \code
+ *     ArduinoAtoLevelBank levelBank{&PINF, &DDRF, &PORTF, 0b00010011}; // <- A0, A1, A4
+ *     levelBank.connect(0, sumpAtoStation, AtoLevelChannel::Reservoir);   // A0, shared reservoir
+ *     levelBank.connect(0, fragAtoStation, AtoLevelChannel::Reservoir);
+ *     levelBank.connect(1, sumpAtoStation, AtoLevelChannel::Normal);      // A1
+ *     levelBank.connect(4, fragAtoStation, AtoLevelChannel::Normal);      // A4
+ * \endcode
+ */
+class ArduinoAtoLevelBank :
+        public AbstractAtoLevelBank {
+
+private:
+
+    volatile uint8_t *const pInputRegister;
+    volatile uint8_t *const pDirectionRegister;
+    volatile uint8_t *const pOutputRegister;
+    uint8_t const pinMask;
+
+public:
+
+    /**
+     * @param pInputRegister – port input register, e.g. <tt>&PINF</tt>
+     * @param pDirectionRegister – port data direction register, e.g. <tt>&DDRF</tt>
+     * @param pOutputRegister – port output register, e.g. <tt>&PORTF</tt>, clears the pull-ups of the masked pins
+     * @param pinMask – port pins wired to level sensors
+     */
+    ArduinoAtoLevelBank(
+            volatile uint8_t *const pInputRegister,
+            volatile uint8_t *const pDirectionRegister,
+            volatile uint8_t *const pOutputRegister,
+            uint8_t const pinMask
+    ) :
+            pInputRegister(pInputRegister),
+            pDirectionRegister(pDirectionRegister),
+            pOutputRegister(pOutputRegister),
+            pinMask(pinMask) {}
+
+    void setup() override {
+        uint8_t oldSREG = SREG; /* warn: AVR specific, read-modify-write of a port other code may use */
+        cli();
+        *pDirectionRegister &= static_cast<uint8_t>(~pinMask);
+        *pOutputRegister &= static_cast<uint8_t>(~pinMask);
+        SREG = oldSREG;
+    }
+
+protected:
+
+    uint32_t readInputs() override {
+        return *pInputRegister & pinMask;
+    }
+};
+
+#endif
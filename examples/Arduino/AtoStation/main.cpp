@@ -1,15 +1,23 @@
+//#define __SERIAL_DEBUG__ // <- Serial console: the dispense journal and debug logs
+
 #include <Arduino.h>
 #include <avr/wdt.h>
 
+#ifdef __SERIAL_DEBUG__
+#include <Streaming.h>
+#endif
+
 #include <Abstract/AbstractRunnable.h>
 
 #include "../Common/ArduinoSwitchable.h"
 #include "../Common/ArduinoSleepPushButton.h"
 #include "../Common/ArduinoBuzzer.h"
+#include "../Common/ArduinoPatternSequencer.h"
 #include "ArduinoAtoLedController.h"
 #include "ArduinoAtoLevelSensor.h"
 
 #include <AtoStation/AtoSettings.h>
+#include <AlarmStation/AlarmStation.h>
 #include <AtoStation/AtoStation.h>
 #include <AtoStation/HighLevelSensorConnection.h>
 #include <AtoStation/NormalLevelSensorConnection.h>
@@ -34,7 +42,7 @@ namespace McuPin {
     constexpr uint8_t YellowLed = 11;
     constexpr uint8_t GreenLed = 10;
     constexpr uint8_t AtoDispenser = 4;
-    constexpr uint8_t SleepPushButton = 3;
+    constexpr uint8_t SleepPushButton = 3; // <- move to 2 with ArduinoToneBuzzer, it needs pin 3
     constexpr uint8_t Buzzer = 2;
 
     constexpr uint8_t NormalLiquidLevelSensor = PIN_A0;
@@ -79,17 +87,25 @@ ArduinoAtoLevelSensor atoReservoirLowLiquidLevelSensor =
 
 /**
  * Create signalling led controller.
+ * All leds are played by one sequencer, they must be on the same port.
  * Remove/Comment not implemented hardware.
  */
-ArduinoAtoLedController atoLedController(atoStation, McuPin::RedLed, McuPin::YellowLed, McuPin::GreenLed);
+ArduinoPatternSequencer ledSequencer{};
+uint8_t const redLedChannel = ledSequencer.attachPin(McuPin::RedLed);
+uint8_t const yellowLedChannel = ledSequencer.attachPin(McuPin::YellowLed);
+uint8_t const greenLedChannel = ledSequencer.attachPin(McuPin::GreenLed);
+ArduinoAtoLedController atoLedController(atoStation, ledSequencer, redLedChannel, yellowLedChannel, greenLedChannel);
 
 /**
  * Create alarm station.
  * Remove/Comment not implemented hardware.
+ * <tt>FixedAlarmStation</tt> keeps the alarms in bit masks, no heap, <tt>AlarmStation</tt> keeps them in a list.
  */
 ArduinoBuzzer buzzer(McuPin::Buzzer);
 static LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> alarmNotifyConfigurations{};
-AlarmStation alarmStation{buzzer, alarmNotifyConfigurations};
+FixedAlarmStation alarmStation{buzzer, alarmNotifyConfigurations};
+AlarmFlapFilter alarmFlapFilter{}; // <- 1 s slots, hold 5 s, doubled up to 320 s while a level sensor flaps
+AlarmEscalation alarmEscalation{};
 
 /**
  * Sleep button.
@@ -98,10 +114,54 @@ AlarmStation alarmStation{buzzer, alarmNotifyConfigurations};
 constexpr uint8_t atoSleepMinutes = 90;
 ArduinoSleepPushButton sleepPushButton{15, 2000, atoSleepMinutes, atoStation, McuPin::SleepPushButton};
 
+#ifdef __SERIAL_DEBUG__
+/**
+ * Prints the dispense journal, oldest first, when <tt>j</tt> is received over Serial.
+ * One line per dispense: start (s since boot), duration (0.1 s), end reason, reservoir level.
+ * One record per loop and only while the transmit buffer takes the whole line, so the loop never waits for Serial.
+ */
+uint8_t journalPrintIndex = UINT8_MAX; // <- next record to print, UINT8_MAX while idle
+
+void printDispenseJournal() {
+    if (journalPrintIndex == UINT8_MAX) {
+        if (Serial.available() == 0 || Serial.read() != 'j') {
+            return;
+        }
+        journalPrintIndex = 0;
+    }
+    if (journalPrintIndex >= atoStation.getDispenseJournal().size()) {
+        journalPrintIndex = UINT8_MAX;
+        return;
+    }
+    if (Serial.availableForWrite() < 32) {
+        return;
+    }
+    uint8_t index = 0;
+    atoStation.getDispenseJournal().forEach([&index](AtoDispenseJournalEntry const &entry) {
+        if (index++ != journalPrintIndex) {
+            return;
+        }
+        Serial.print(entry.startS);
+        Serial.print(',');
+        Serial.print(entry.durationDs);
+        Serial.print(',');
+        Serial.print(static_cast<uint8_t>(entry.reason));
+        Serial.print(',');
+        Serial.println(static_cast<uint8_t>(entry.reservoirLevel));
+    });
+    ++journalPrintIndex;
+}
+#endif
+
 void setup() {
     /* Disable watchdog timer first thing, in case it is misconfigured */
     wdt_disable();
 
+#ifdef __SERIAL_DEBUG__
+    /* Serial console for the dispense journal */
+    Serial.begin(9600);
+#endif
+
     /**
      * Remove/Comment if alarms not desired or not implemented.
      */
@@ -110,6 +170,15 @@ void setup() {
     alarmNotifyConfigurations.put(AlarmSeverity::Major, AlarmNotifyConfiguration(5, 5000));
     alarmNotifyConfigurations.put(AlarmSeverity::Critical, AlarmNotifyConfiguration(1, 7000));
 
+    /* severity tone and alarm code beeps instead of the durations above, see BuzzerPattern::forAlarm() */
+    alarmStation.setPatternNotifications(true);
+    alarmStation.attachFlapFilter(&alarmFlapFilter);
+
+    /* alarms nobody acknowledges get louder, minutes since raised */
+    alarmEscalation.setRule(AlarmSeverity::Minor, AlarmSeverity::Major, 30);
+    alarmEscalation.setRule(AlarmSeverity::Major, AlarmSeverity::Critical, 120);
+    alarmStation.attachEscalation(&alarmEscalation);
+
     /**
      * Remove/Comment if alarms not desired or not implemented.
      */
@@ -130,4 +199,8 @@ void loop() {
 
     /* Do not edit! */
     AbstractRunnable::loopAll();
+
+#ifdef __SERIAL_DEBUG__
+    printDispenseJournal();
+#endif
 }
\ No newline at end of file
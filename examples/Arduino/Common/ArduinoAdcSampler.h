@@ -0,0 +1,157 @@
+#ifndef _AQUARIUM_CONTROLLER_ARDUINO_COMMON_ARDUINO_ADC_SAMPLER_H_
+#define _AQUARIUM_CONTROLLER_ARDUINO_COMMON_ARDUINO_ADC_SAMPLER_H_
+#pragma once
+
+#include <stdint.h>
+#include <avr/interrupt.h>
+
+#include <Abstract/AbstractRunnable.h>
+#include <Common/OversamplingAccumulator.h>
+
+#ifndef ADC_SAMPLER_MAX_CHANNELS
+#define ADC_SAMPLER_MAX_CHANNELS 4
+#endif
+
+/**
+ * <br/>
+ * Interrupt driven ATmega328 ADC acquisition.<br/>
+ * Conversions run back to back without the loop ever waiting on the converter: the ADC interrupt
+ * stores the result into the channel's <tt>OversamplingAccumulator</tt>, switches the multiplexer
+ * to the next configured channel (round-robin) and starts the next conversion.<br/>
+ * With the 125 kHz ADC clock every conversion takes 104 µs, one value with <tt>extraBits</tt>
+ * takes <tt>4^extraBits × channels × 104 µs</tt>, e.g. 2 extra bits on 2 channels ≈ 3.3 ms.<br/>
+ * Do not call <tt>analogRead()</tt> while the sampler runs, it owns the converter.<br/>
+ * The header defines <tt>ISR(ADC_vect)</tt>, an interrupt vector is defined once per program:
+ * in a sketch of several translation units define <tt>ADC_SAMPLER_NO_ISR</tt> before every include but one.
+ * \code
+ *     ArduinoAdcSampler adcSampler{};
+ *     const uint8_t phProbe = adcSampler.addChannel(0, 3); // <- A0, 13-bit values
+ *     ...
+ *     if (adcSampler.getSequence(phProbe) != lastSequence) { uint16_t ph = adcSampler.getValue(phProbe); }
+ * \endcode
+ */
+class ArduinoAdcSampler :
+        public AbstractRunnable {
+
+private:
+
+    /**
+     * <br/>
+     * Function local, one pointer for every translation unit including the header.
+     */
+    static ArduinoAdcSampler *&instance() {
+        static ArduinoAdcSampler *pInstance = nullptr;
+        return pInstance;
+    }
+
+    OversamplingAccumulator accumulators[ADC_SAMPLER_MAX_CHANNELS];
+    uint8_t channels[ADC_SAMPLER_MAX_CHANNELS];
+    uint8_t channelCount = 0;
+    volatile uint8_t currentIndex = 0;
+
+    static void selectChannel(uint8_t const channel) {
+        /* AVcc reference, right adjusted result */
+        ADMUX = static_cast<uint8_t>(_BV(REFS0) | (channel & 0x07u)); /* warn: Arduino specific */
+    }
+
+public:
+
+    ArduinoAdcSampler() : accumulators{}, channels{} {}
+
+    /**
+     * <br/>
+     * Call before <tt>setup()</tt>.
+     *
+     * @param channel – analog input number, 0 for A0 ... 7 for A7
+     * @param extraBits – oversampling bits added to the 10-bit result, up to <tt>OversamplingAccumulator::maxExtraBits</tt>
+     * @return index used to read the channel, <tt>UINT8_MAX</tt> if all channels are taken
+     */
+    uint8_t addChannel(uint8_t const channel, uint8_t const extraBits) {
+        if (channelCount == ADC_SAMPLER_MAX_CHANNELS) {
+            return UINT8_MAX;
+        }
+        channels[channelCount] = channel;
+        accumulators[channelCount].setExtraBits(extraBits);
+        return channelCount++;
+    }
+
+    /**
+     * <br/>
+     * Last finished value of the channel, O(1).
+     */
+    uint16_t getValue(uint8_t const index) const {
+        uint8_t oldSREG = SREG; /* warn: Arduino specific */
+        cli();
+        uint16_t value = accumulators[index].getValue();
+        SREG = oldSREG;
+        return value;
+    }
+
+    /**
+     * <br/>
+     * Changes with every finished value of the channel, <tt>0</tt> until the first one.
+     */
+    uint8_t getSequence(uint8_t const index) const {
+        return accumulators[index].getSequence();
+    }
+
+    uint8_t getResolutionBits(uint8_t const index) const {
+        return static_cast<uint8_t>(10 + accumulators[index].getExtraBits());
+    }
+
+    /**
+     * <br/>
+     * Called from the ADC interrupt only.
+     */
+    void onConversionComplete(uint16_t const sample) {
+        accumulators[currentIndex].add(sample);
+
+        uint8_t nextIndex = static_cast<uint8_t>(currentIndex + 1);
+        if (nextIndex == channelCount) {
+            nextIndex = 0;
+        }
+        currentIndex = nextIndex;
+
+        ArduinoAdcSampler::selectChannel(channels[nextIndex]);
+        ADCSRA |= _BV(ADSC); /* warn: Arduino specific */
+    }
+
+    static void handleInterrupt() {
+        ArduinoAdcSampler *pInstance = ArduinoAdcSampler::instance();
+        if (pInstance != nullptr) {
+            pInstance->onConversionComplete(ADC); /* warn: Arduino specific */
+        }
+    }
+
+    void setup() override {
+        if (channelCount == 0) {
+            return;
+        }
+        ArduinoAdcSampler::instance() = this;
+
+        /* digital input buffers off on used analog pins, less noise and power */
+        for (uint8_t index = 0; index < channelCount; ++index) {
+            if (channels[index] < 6) {
+                DIDR0 |= static_cast<uint8_t>(_BV(channels[index])); /* warn: Arduino specific */
+            }
+        }
+
+        currentIndex = 0;
+        ArduinoAdcSampler::selectChannel(channels[0]);
+
+        /* enable, interrupt, prescaler 128 -> 125 kHz ADC clock at 16 MHz, start the first conversion */
+        ADCSRA = static_cast<uint8_t>(_BV(ADEN) | _BV(ADIE) | _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0) | _BV(ADSC));
+    }
+
+    void loop() override {
+        // pass, conversions run from the interrupt
+    }
+};
+
+#ifndef ADC_SAMPLER_NO_ISR
+ISR(ADC_vect) {
+    ArduinoAdcSampler::handleInterrupt();
+}
+#endif
+
+#endif
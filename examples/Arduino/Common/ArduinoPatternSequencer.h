@@ -0,0 +1,77 @@
+#ifndef _AQUARIUM_CONTROLLER_ARDUINO_COMMON_ARDUINO_PATTERN_SEQUENCER_H_
+#define _AQUARIUM_CONTROLLER_ARDUINO_COMMON_ARDUINO_PATTERN_SEQUENCER_H_
+#pragma once
+
+#include <Abstract/AbstractPatternSequencer.h>
+
+/**
+ * <br/>
+ * Pattern sequencer on pins of one AVR port, all pins are written with a single port update.<br/>
+ * Channels are numbered in attach order, pins on another port than the first one are rejected.
+ * \code
+ *     ArduinoPatternSequencer ledSequencer{};
+ *     uint8_t const redLed = ledSequencer.attachPin(12); // <- channel 0
+ *     ledSequencer.setPattern(redLed, Pattern::FastBlink);
+ * \endcode
+ */
+class ArduinoPatternSequencer :
+        public AbstractPatternSequencer {
+
+private:
+
+    volatile uint8_t *pPort = nullptr;
+    uint8_t mcuPins[AbstractPatternSequencer::channelCount];
+    uint8_t pinMasks[AbstractPatternSequencer::channelCount];
+    uint8_t portMask = 0;
+    uint8_t pinCount = 0;
+
+public:
+
+    explicit ArduinoPatternSequencer(uint16_t const stepMs = PATTERN_SEQUENCER_STEP_MS) :
+            AbstractPatternSequencer(stepMs),
+            mcuPins{},
+            pinMasks{} {}
+
+    /**
+     * @param mcuPin – output pin
+     * @return channel of the pin, <tt>channelCount</tt> if rejected
+     */
+    uint8_t attachPin(uint8_t const mcuPin) {
+        volatile uint8_t *pPinPort = portOutputRegister(digitalPinToPort(mcuPin)); /* warn: AVR specific */
+        if (pinCount >= AbstractPatternSequencer::channelCount || (pPort != nullptr && pPinPort != pPort)) {
+            return AbstractPatternSequencer::channelCount;
+        }
+        pPort = pPinPort;
+        mcuPins[pinCount] = mcuPin;
+        pinMasks[pinCount] = digitalPinToBitMask(mcuPin);
+        portMask |= pinMasks[pinCount];
+        return pinCount++;
+    }
+
+    void setup() override {
+        for (uint8_t channel = 0; channel < pinCount; ++channel) {
+            pinMode(mcuPins[channel], OUTPUT); /* warn: Arduino specific */
+        }
+    }
+
+protected:
+
+    void writeOutputs(uint8_t const outputs) override {
+        if (pPort == nullptr) {
+            return;
+        }
+        uint8_t pinBits = 0;
+        for (uint8_t channel = 0; channel < pinCount; ++channel) {
+            if (outputs & (1u << channel)) {
+                pinBits |= pinMasks[channel];
+            }
+        }
+
+        uint8_t oldSreg = SREG; /* warn: AVR specific, read-modify-write must not race an ISR on the same port */
+        cli();
+        *pPort = static_cast<uint8_t>((*pPort & ~portMask) | pinBits);
+        SREG = oldSreg;
+    }
+};
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef _AQUARIUM_CONTROLLER_ARDUINO_COMMON_ARDUINO_TONE_BUZZER_H_
+#define _AQUARIUM_CONTROLLER_ARDUINO_COMMON_ARDUINO_TONE_BUZZER_H_
+#pragma once
+
+#include <stdint.h>
+#include <avr/interrupt.h>
+
+#include <Abstract/AbstractBuzzer.h>
+#include <Common/ToneEnvelope.h>
+
+/**
+ * <br/>
+ * Passive buzzer on ATmega328 Timer2, phase correct PWM with <tt>OCR2A</tt> as TOP, tone on <tt>OC2B</tt> (pin 3).<br/>
+ * Every switch on starts the configured <tt>ToneEnvelope</tt>, the timer overflow interrupt moves frequency and
+ * volume once per millisecond and only writes the double buffered compare registers,
+ * the loop does nothing and a slow runnable cannot make the tone jitter.<br/>
+ * With prescaler 32 at 16 MHz the tone range is 980 Hz – 125 kHz.
+ * Timer2 is taken, <tt>tone()</tt> and PWM on pins 3 and 11 are not available, pin 3 is fixed by the hardware.<br/>
+ * The header defines <tt>ISR(TIMER2_OVF_vect)</tt>, an interrupt vector is defined once per program:
+ * in a sketch of several translation units define <tt>TONE_BUZZER_NO_ISR</tt> before every include but one.
+ * \code
+ *     ArduinoToneBuzzer buzzer{};
+ *     buzzer.setTone(2500, 3500, 255, 128, 120, true); // <- chirp up every 120 ms, fading
+ * \endcode
+ */
+class ArduinoToneBuzzer : public AbstractBuzzer {
+
+private:
+
+    static constexpr uint8_t mcuPin = 3; // <- OC2B
+    static constexpr uint32_t timerHz = F_CPU / 32;
+
+    /**
+     * <br/>
+     * Function local, one pointer for every translation unit including the header.
+     */
+    static ArduinoToneBuzzer *&instance() {
+        static ArduinoToneBuzzer *pInstance = nullptr;
+        return pInstance;
+    }
+
+    ToneEnvelope envelope{timerHz};
+
+    uint16_t startHz = 2700;
+    uint16_t endHz = 2700;
+    uint8_t startVolume = 255;
+    uint8_t endVolume = 255;
+    uint16_t sweepMs = 0;
+    bool repeating = false;
+
+    void setState(Switched const newState) override {
+        if (AbstractBuzzer::getState() == newState) {
+            return;
+        }
+        AbstractBuzzer::setState(newState);
+
+        uint8_t oldSREG = SREG; /* warn: Arduino specific, the interrupt reads the envelope */
+        cli();
+        if (AbstractBuzzer::isInState(Switched::On)) {
+            envelope.start(startHz, endHz, startVolume, endVolume, sweepMs, repeating);
+            OCR2A = envelope.getTop(); /* warn: Arduino specific */
+            OCR2B = envelope.getCompare();
+            TCNT2 = 0;
+            TCCR2A = static_cast<uint8_t>(_BV(COM2B1) | _BV(WGM20)); // <- non-inverting on OC2B, phase correct
+            TCCR2B = static_cast<uint8_t>(_BV(WGM22) | _BV(CS21) | _BV(CS20)); // <- TOP = OCR2A, clk / 32
+            TIMSK2 = static_cast<uint8_t>(sweepMs > 0 ? _BV(TOIE2) : 0); // <- a steady tone needs no interrupt
+        } else {
+            TIMSK2 = 0; /* warn: Arduino specific */
+            TCCR2B = 0;
+            TCCR2A = 0; // <- OC2B disconnected, the pin falls back to PORTD, low
+            envelope.stop();
+        }
+        SREG = oldSREG;
+    }
+
+public:
+
+    ArduinoToneBuzzer() = default;
+
+    explicit ArduinoToneBuzzer(uint16_t const buzzRestMs) : AbstractBuzzer(buzzRestMs) {}
+
+    /**
+     * <br/>
+     * Tone of the next switch on, a sounding tone is not changed.
+     *
+     * @param sweepMs – 0 for a steady tone at <tt>startHz</tt> and <tt>startVolume</tt>
+     * @param repeating – start over after <tt>sweepMs</tt>, otherwise hold the end values
+     */
+    void setTone(
+            uint16_t const startHz,
+            uint16_t const endHz,
+            uint8_t const startVolume,
+            uint8_t const endVolume,
+            uint16_t const sweepMs,
+            bool const repeating
+    ) {
+        ArduinoToneBuzzer::startHz = startHz;
+        ArduinoToneBuzzer::endHz = endHz;
+        ArduinoToneBuzzer::startVolume = startVolume;
+        ArduinoToneBuzzer::endVolume = endVolume;
+        ArduinoToneBuzzer::sweepMs = sweepMs;
+        ArduinoToneBuzzer::repeating = repeating;
+    }
+
+    /**
+     * <br/>
+     * Called from the Timer2 overflow interrupt only, at the end of every tone period.
+     */
+    void onTimerOverflow() {
+        if (envelope.onPeriod()) {
+            OCR2A = envelope.getTop(); /* warn: Arduino specific */
+            OCR2B = envelope.getCompare();
+        }
+    }
+
+    static void handleInterrupt() {
+        ArduinoToneBuzzer *pInstance = ArduinoToneBuzzer::instance();
+        if (pInstance != nullptr) {
+            pInstance->onTimerOverflow();
+        }
+    }
+
+    void setup() override {
+        ArduinoToneBuzzer::instance() = this;
+        digitalWrite(mcuPin, LOW); /* warn: Arduino specific */
+        pinMode(mcuPin, OUTPUT);
+        TIMSK2 = 0;
+        TCCR2A = 0;
+        TCCR2B = 0;
+    }
+};
+
+#ifndef TONE_BUZZER_NO_ISR
+ISR(TIMER2_OVF_vect) {
+    ArduinoToneBuzzer::handleInterrupt();
+}
+#endif
+
+#endif
@@ -4,9 +4,13 @@
 
 #include <Abstract/AbstractRunnable.h>
 #include <Common/Switchable.h>
+#include <Common/BuzzerPattern.h>
 
 /**
  * <br/>
+ * Plays one continuous <tt>buzz</tt>, or a <tt>BuzzerPattern</tt> step by step, both followed by the rest period.
+ * Nothing blocks, a loop between steps costs one subtraction.<br/>
+ * A pattern played with a higher priority preempts whatever is sounding or resting, a continuous buzz has priority 0.<br/>
  * To do, implement / override:
  * <ul>
  * <li><tt>void AbstractRunnable::setup()</tt></li>
@@ -23,9 +27,37 @@ private:
     uint16_t buzzRestMs = 0;
     uint32_t buzzStartMs = 0;
 
+    BuzzerPattern pattern{};
+    uint32_t stepStartMs = 0;
+    uint8_t step = 0;
+    uint8_t priority = 0;
+
     bool busy = false;
+    bool playing = false;
 
     void loop() override {
+        if (playing) {
+            uint32_t nowMs = millis();
+            if (nowMs - stepStartMs < BUZZER_PATTERN_STEP_MS) {
+                return;
+            }
+            /* a late loop skips steps */
+            while (nowMs - stepStartMs >= BUZZER_PATTERN_STEP_MS && step < pattern.getLength()) {
+                stepStartMs += BUZZER_PATTERN_STEP_MS;
+                ++step;
+            }
+            if (step >= pattern.getLength()) {
+                /* pattern done, rest as after a buzz */
+                playing = false;
+                buzzMs = 0;
+                buzzStartMs = nowMs;
+                AbstractBuzzer::switchTo(Switched::Off);
+                return;
+            }
+            AbstractBuzzer::switchTo(pattern.isOn(step) ? Switched::On : Switched::Off);
+            return;
+        }
+
         if (busy) {
             if (Switchable::isInState(Switched::On) && (millis() - buzzStartMs >= buzzMs)) {
                 setState(Switched::Off);
@@ -38,6 +70,12 @@ private:
         }
     }
 
+    void switchTo(Switched const newState) {
+        if (!Switchable::isInState(newState)) {
+            setState(newState);
+        }
+    }
+
 public:
 
     explicit AbstractBuzzer() = default;
@@ -47,20 +85,43 @@ public:
     ~AbstractBuzzer() override = default;
 
     bool buzz(uint16_t const &buzzMs) {
-        if (Switchable::isInState(Switched::Off)) {
+        if (Switchable::isInState(Switched::Off) && !playing) {
             AbstractBuzzer::buzzMs = buzzMs;
             setState(Switched::On);
             buzzStartMs = millis();
+            priority = 0;
             busy = true;
             return true;
         }
         return false;
     }
 
+    /**
+     * <br/>
+     * Starts the pattern at once if the buzzer is free, or busy with a lower priority.
+     *
+     * @return <tt>false</tt> if the pattern is empty or something with the same or a higher priority is sounding or resting
+     */
+    bool play(BuzzerPattern const &newPattern, uint8_t const newPriority) {
+        if (newPattern.isEmpty() || (busy && newPriority <= priority)) {
+            return false;
+        }
+        pattern = newPattern;
+        priority = newPriority;
+        step = 0;
+        stepStartMs = millis();
+        busy = true;
+        playing = true;
+        AbstractBuzzer::switchTo(pattern.isOn(0) ? Switched::On : Switched::Off);
+        return true;
+    }
+
     bool stop() {
         if (busy) {
             setState(Switched::Off);
             busy = false;
+            playing = false;
+            priority = 0;
             return true;
         }
         return false;
@@ -69,6 +130,18 @@ public:
     bool isBusy() const {
         return busy;
     }
+
+    bool isPlaying() const {
+        return playing;
+    }
+
+    /**
+     * <br/>
+     * Priority of the pattern sounding or resting, 0 if free or busy with a continuous buzz.
+     */
+    uint8_t getPriority() const {
+        return busy ? priority : 0;
+    }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,141 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ABSTRACT_ABSTRACT_PATTERN_SEQUENCER_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ABSTRACT_ABSTRACT_PATTERN_SEQUENCER_H_
+#pragma once
+
+#ifdef __TEST_MODE__
+
+#include <stdint.h>
+#include "../../test/_Mocks/MockCommon.h"
+
+#endif
+
+#include <Abstract/AbstractRunnable.h>
+
+#ifndef PATTERN_SEQUENCER_STEP_MS
+#define PATTERN_SEQUENCER_STEP_MS 80
+#endif
+
+/**
+ * <br/>
+ * Blink patterns of up to 8 outputs, 32 steps each, bit <tt>n</tt> of a pattern is the output in step <tt>n</tt>.
+ * With the default 80 ms step a pattern lasts 2560 ms.
+ */
+namespace Pattern {
+    constexpr uint32_t Off = 0x00000000ul;
+    constexpr uint32_t On = 0xFFFFFFFFul;
+    constexpr uint32_t SlowBlink = 0x007FFFFFul;    // <- 1840 ms on, 720 ms off
+    constexpr uint32_t FastBlink = 0x01FF01FFul;    // <- 720 ms on, 560 ms off, twice
+    constexpr uint32_t Flash = 0x00000001ul;        // <- 80 ms on
+}
+
+/**
+ * <br/>
+ * One runnable for all status outputs, no heap.<br/>
+ * The step counter is locked to <tt>millis()</tt>, every channel reads the same step,
+ * so outputs blinking with the same or a harmonic pattern stay in phase, also after a pattern change.<br/>
+ * A loop between steps costs one subtraction, <tt>writeOutputs</tt> is called with all outputs
+ * at once and only when one of them changes.<br/>
+ * To do, implement / override:
+ * <ul>
+ * <li><tt>void AbstractRunnable::setup()</tt></li>
+ * <li><tt>void AbstractPatternSequencer::writeOutputs(uint8_t outputs)</tt>, bit <tt>n</tt> is channel <tt>n</tt></li>
+ * </ul>
+ */
+class AbstractPatternSequencer :
+        public AbstractRunnable {
+
+public:
+
+    static constexpr uint8_t channelCount = 8;
+    static constexpr uint8_t stepCount = 32;
+
+private:
+
+    uint32_t patterns[channelCount];
+    uint16_t stepMs;
+    uint32_t stepStartMs = 0;
+    uint8_t step = 0;
+    uint8_t outputs = 0;
+    bool hasStarted = false;
+    bool isDirty = false;
+
+public:
+
+    explicit AbstractPatternSequencer(uint16_t const stepMs = PATTERN_SEQUENCER_STEP_MS) :
+            patterns{},
+            stepMs(stepMs) {}
+
+    virtual ~AbstractPatternSequencer() = default;
+
+    /**
+     * <br/>
+     * Takes effect on the next loop, in the current step of the common sequence.
+     */
+    void setPattern(uint8_t const channel, uint32_t const pattern) {
+        if (channel < channelCount) {
+            isDirty = patterns[channel] != pattern || isDirty;
+            patterns[channel] = pattern;
+        }
+    }
+
+    uint32_t getPattern(uint8_t const channel) const {
+        return channel < channelCount ? patterns[channel] : Pattern::Off;
+    }
+
+    uint8_t getOutputs() const {
+        return outputs;
+    }
+
+    uint8_t getStep() const {
+        return step;
+    }
+
+    void loop() override {
+        uint32_t nowMs = millis();
+
+        if (!hasStarted) {
+            /* phase is millis() itself, any sequencer with the same step length is in sync */
+            step = static_cast<uint8_t>((nowMs / stepMs) % stepCount);
+            stepStartMs = nowMs - nowMs % stepMs;
+            hasStarted = true;
+            AbstractPatternSequencer::refresh();
+            return;
+        }
+
+        if (nowMs - stepStartMs < stepMs) {
+            if (isDirty) {
+                AbstractPatternSequencer::refresh();
+            }
+            return;
+        }
+
+        /* a late loop skips steps, the phase stays locked */
+        while (nowMs - stepStartMs >= stepMs) {
+            stepStartMs += stepMs;
+            step = static_cast<uint8_t>((step + 1) % stepCount);
+        }
+        AbstractPatternSequencer::refresh();
+    }
+
+protected:
+
+    virtual void writeOutputs(uint8_t outputs) = 0;
+
+private:
+
+    void refresh() {
+        isDirty = false;
+        uint8_t newOutputs = 0;
+        for (uint8_t channel = 0; channel < channelCount; ++channel) {
+            if ((patterns[channel] >> step) & 1ul) {
+                newOutputs |= static_cast<uint8_t>(1u << channel);
+            }
+        }
+        if (newOutputs != outputs) {
+            outputs = newOutputs;
+            writeOutputs(outputs);
+        }
+    }
+};
+
+#endif
@@ -2,6 +2,8 @@
 #define _AQUARIUM_CONTROLLER_INCLUDE_ABSTRACT_I_FORWARDER_H_
 #pragma once
 
+#include "Enums/ReadingQuality.h"
+
 /**
  * <br/>
  * Interface between sensor objects and connection objects.<br/>
@@ -9,6 +11,7 @@
  * <ul>
  * <li><tt>void forward(T const &data)</tt></li>
  * </ul>
+ * Override <tt>forwardQuality</tt> to learn of a failed read, a forwarded reading is always <tt>Ok</tt>.
  *
  * @tparam T – forward data type
  */
@@ -20,6 +23,10 @@ public:
     virtual ~IForwarder() = default;
     
     virtual void forward(T const &data) const = 0;
+
+    virtual void forwardQuality(ReadingQuality const) const {
+        // pass
+    }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,165 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ALARM_STATION_ABSTRACT_ALARM_STATION_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ALARM_STATION_ABSTRACT_ALARM_STATION_H_
+#pragma once
+
+#include <stdint.h>
+
+#include <Enums/State.h>
+#include <Enums/AlarmCode.h>
+#include <Enums/AlarmSeverity.h>
+#include <Abstract/AbstractRunnable.h>
+#include <Abstract/AbstractSleepable.h>
+#include "AlarmFlapFilter.h"
+
+/**
+ * <br/>
+ * What stations see of the alarm station, independent of how alarms are stored.<br/>
+ * Stations report conditions through <tt>raiseAlarm</tt>, <tt>clearAlarm</tt> and <tt>removeAlarm</tt>.<br/>
+ * The last reported state of every code is kept in a bit mask, the storage is only touched when
+ * the state changes, so reporting a persisting condition on every loop costs one bit test.<br/>
+ * An alarm acknowledged by the user stays acknowledged until the condition clears and is raised again.<br/>
+ * With an <tt>AlarmFlapFilter</tt> attached, raise and clear edges of a noisy condition are held back,
+ * deferred ones are applied by <tt>applyDeferredReports()</tt> from the loop.<br/>
+ * To do, implement / override:
+ * <ul>
+ * <li><tt>void AbstractRunnable::loop()</tt></li>
+ * <li><tt>void AbstractAlarmStation::addAlarm(AlarmCode alarmCode, AlarmSeverity alarmSeverity)</tt></li>
+ * <li><tt>void AbstractAlarmStation::acknowledgeAlarm(AlarmCode alarmCode)</tt></li>
+ * <li><tt>void AbstractAlarmStation::deleteAlarm(AlarmCode alarmCode)</tt></li>
+ * </ul>
+ */
+class AbstractAlarmStation :
+        public AbstractRunnable,
+        public AbstractSleepable {
+
+    State alarmStationState = State::Active;
+
+    uint32_t reportedAlarms = 0;
+
+    AlarmFlapFilter *pFlapFilter = nullptr;
+
+    static uint32_t alarmBit(AlarmCode const alarmCode) {
+        uint8_t index = static_cast<uint8_t>(alarmCode);
+        return index < 32 ? 1ul << index : 0;
+    }
+
+public:
+
+    virtual ~AbstractAlarmStation() = default;
+
+    /* § Section: State Methods */
+
+    void setState(State const newStationState) {
+        alarmStationState = newStationState;
+    }
+
+    State const &getState() const {
+        return alarmStationState;
+    }
+
+    bool isInState(State const &compareState) const {
+        return alarmStationState == compareState;
+    }
+
+    /* § Section: Edge Triggered Alarms */
+
+    /**
+     * <br/>
+     * Adds the alarm, or un-acknowledges it, unless it is already reported as raised.
+     */
+    void raiseAlarm(AlarmCode const alarmCode, AlarmSeverity const alarmSeverity) {
+        uint32_t bit = AbstractAlarmStation::alarmBit(alarmCode);
+        if (alarmCode == AlarmCode::NoAlarm || (reportedAlarms & bit)) {
+            return;
+        }
+        reportedAlarms |= bit;
+        if (pFlapFilter == nullptr || pFlapFilter->report(alarmCode, true, alarmSeverity, millis())) {
+            addAlarm(alarmCode, alarmSeverity);
+        }
+    }
+
+    /**
+     * <br/>
+     * Acknowledges the alarm if it is reported as raised, the alarm stays stored.
+     */
+    void clearAlarm(AlarmCode const alarmCode) {
+        uint32_t bit = AbstractAlarmStation::alarmBit(alarmCode);
+        if (!(reportedAlarms & bit)) {
+            return;
+        }
+        reportedAlarms &= ~bit;
+        if (pFlapFilter == nullptr || pFlapFilter->report(alarmCode, false, AlarmSeverity::NoSeverity, millis())) {
+            acknowledgeAlarm(alarmCode);
+        }
+    }
+
+    /**
+     * <br/>
+     * Deletes the alarm at once, also when flap filtered.
+     */
+    void removeAlarm(AlarmCode const alarmCode) {
+        reportedAlarms &= ~AbstractAlarmStation::alarmBit(alarmCode);
+        if (pFlapFilter != nullptr) {
+            pFlapFilter->reset(alarmCode);
+        }
+        deleteAlarm(alarmCode);
+    }
+
+    bool isAlarmRaised(AlarmCode const alarmCode) const {
+        return (reportedAlarms & AbstractAlarmStation::alarmBit(alarmCode)) != 0;
+    }
+
+    /**
+     * <br/>
+     * Rate limits raise / clear edges per code, <tt>nullptr</tt> detaches.
+     * Deferred changes of a detached filter are dropped.
+     */
+    void attachFlapFilter(AlarmFlapFilter *const pAlarmFlapFilter) {
+        pFlapFilter = pAlarmFlapFilter;
+    }
+
+    /* § Section: ISleepable Methods */
+
+    void startSleeping(uint32_t const &sleepMs) override {
+        AbstractSleepable::startSleeping(sleepMs);
+        AbstractAlarmStation::setState(State::Sleeping);
+    }
+
+    void stopSleeping() override {
+        AbstractSleepable::stopSleeping();
+        AbstractAlarmStation::setState(State::Active);
+    }
+
+    /* § Section: Runnable Methods */
+
+    void setup() override {
+        // pass
+    }
+
+protected:
+
+    /**
+     * <br/>
+     * Applies the deferred changes whose hold time is over, call from <tt>loop()</tt>.
+     */
+    void applyDeferredReports() {
+        if (pFlapFilter == nullptr) {
+            return;
+        }
+        pFlapFilter->forEachDue(millis(), [this](AlarmCode const alarmCode, bool const isRaised, AlarmSeverity const alarmSeverity) {
+            if (isRaised) {
+                addAlarm(alarmCode, alarmSeverity);
+            } else {
+                acknowledgeAlarm(alarmCode);
+            }
+        });
+    }
+
+    virtual void addAlarm(AlarmCode alarmCode, AlarmSeverity alarmSeverity) = 0;
+
+    virtual void acknowledgeAlarm(AlarmCode alarmCode) = 0;
+
+    virtual void deleteAlarm(AlarmCode alarmCode) = 0;
+};
+
+#endif
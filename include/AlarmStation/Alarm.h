@@ -33,6 +33,10 @@ public:
         return Alarm::severity;
     }
 
+    void setSeverity(AlarmSeverity const alarmSeverity) {
+        Alarm::severity = alarmSeverity;
+    }
+
     bool isAcknowledged() const {
         return Alarm::acknowledged;
     }
@@ -2,78 +2,217 @@
 #define _AQUARIUM_CONTROLLER_INCLUDE_ALARM_STATION_ALARM_ARRAY_H_
 #pragma once
 
+#include <stdint.h>
+
 #include "Enums/AlarmCode.h"
 #include "Enums/AlarmSeverity.h"
 #include "AlarmArrayElement.h"
 
+/**
+ * <br/>
+ * Concrete class, zero-heap alarm storage for <tt>BasicAlarmStation</tt>,
+ * alarms indexed by <tt>AlarmCode</tt>, stored as bit masks, bit <tt>n</tt> is code <tt>n</tt>.<br/>
+ * Active and acknowledged are one mask each, the severity (2 bits) is two masks.
+ * Notification timestamps are a separate array, so state queries never touch them.<br/>
+ * Counting, "any pending" and "highest severity pending" are a few mask operations
+ * (<tt>popcount</tt>, count trailing zeros), independent of <tt>N</tt>.<br/>
+ * <tt>AlarmArray<10></tt> takes 58 bytes on AVR instead of 80, 40 of them timestamps.
+ *
+ * @tparam N – number of alarm codes, at most 32
+ */
 template<int N>
 class AlarmArray {
 
+    static_assert(N > 0 && N <= 32, "AlarmArray holds at most 32 alarm codes");
+
 private:
 
-    AlarmArrayElement alarmArray[N];
+    uint32_t activeMask = 0;
+    uint32_t acknowledgedMask = 0;
+    uint32_t severityLowMask = 0;   // <- bit 0 of the severity
+    uint32_t severityHighMask = 0;  // <- bit 1 of the severity
+    uint32_t lastNotificationMs[N];
+    uint16_t modificationCount = 0;
 
-public:
+    static uint32_t bitOf(AlarmCode const alarmCode) {
+        uint8_t index = static_cast<uint8_t>(alarmCode);
+        return index < static_cast<uint8_t>(N) ? 1ul << index : 0;
+    }
 
-    AlarmArray() {
-        for (uint8_t index = 0; index < static_cast<uint8_t>(N); ++index) {
-            alarmArray[index] = AlarmArrayElement(static_cast<AlarmCode>(index));
-        }
+    static uint8_t countBits(uint32_t const mask) {
+        return static_cast<uint8_t>(__builtin_popcountl(mask));
+    }
+
+    static AlarmCode lowestCode(uint32_t const mask) {
+        return mask == 0 ? AlarmCode::NoAlarm : static_cast<AlarmCode>(__builtin_ctzl(mask));
+    }
+
+    uint32_t severityMask(AlarmSeverity const alarmSeverity) const {
+        uint8_t severity = static_cast<uint8_t>(alarmSeverity);
+        return (severity & 0x01u ? severityLowMask : ~severityLowMask) &
+               (severity & 0x02u ? severityHighMask : ~severityHighMask) &
+               activeMask;
+    }
+
+    AlarmSeverity severityOf(uint32_t const bit) const {
+        return static_cast<AlarmSeverity>((severityLowMask & bit ? 0x01u : 0x00u) | (severityHighMask & bit ? 0x02u : 0x00u));
     }
 
+public:
+
+    AlarmArray() : lastNotificationMs{} {}
+
     ~AlarmArray() {
         AlarmArray::removeAll();
     }
 
-    uint8_t size() {
-        uint8_t active = 0;
-        for (uint8_t index = 0; index < static_cast<uint8_t>(N); ++index) {
-            if (alarmArray[index].isActive()) ++active;
-        }
-        return active;
+    uint8_t size() const {
+        return AlarmArray::countBits(activeMask);
+    }
+
+    bool isEmpty() const {
+        return activeMask == 0;
     }
 
-    bool isEmpty() {
-        return size() == 0;
+    uint16_t getModificationCount() const {
+        return modificationCount;
     }
 
+    /**
+     * <br/>
+     * Adds the alarm, or un-acknowledges it and updates its severity if already present.
+     */
     void add(AlarmCode const &alarmCode, AlarmSeverity const &alarmSeverity) {
-        alarmArray[static_cast<uint8_t>(alarmCode)]
-                .setActive(true)
-                .setSeverity(alarmSeverity);
+        uint32_t bit = AlarmArray::bitOf(alarmCode);
+        if (!(activeMask & bit)) {
+            AlarmArray::setLastNotificationMs(alarmCode, 0);
+        }
+        uint8_t severity = static_cast<uint8_t>(alarmSeverity);
+        activeMask |= bit;
+        acknowledgedMask &= ~bit;
+        severityLowMask = severity & 0x01u ? severityLowMask | bit : severityLowMask & ~bit;
+        severityHighMask = severity & 0x02u ? severityHighMask | bit : severityHighMask & ~bit;
+        ++modificationCount;
     }
 
     void remove(AlarmCode const &alarmCode) {
-        alarmArray[static_cast<uint8_t>(alarmCode)]
-                .setActive(false);
+        uint32_t bit = AlarmArray::bitOf(alarmCode);
+        if (activeMask & bit) {
+            activeMask &= ~bit;
+            acknowledgedMask &= ~bit;
+            ++modificationCount;
+        }
     }
 
     void removeAll() {
-        for (uint8_t index = 0; index < static_cast<uint8_t>(N); ++index) {
-            alarmArray[index].setActive(false);
-        }
+        activeMask = 0;
+        acknowledgedMask = 0;
+        ++modificationCount;
     }
 
     void acknowledge(AlarmCode const &alarmCode) {
-        if (alarmArray[static_cast<uint8_t>(alarmCode)].isActive()) {
-            alarmArray[static_cast<uint8_t>(alarmCode)].acknowledge();
+        uint32_t bit = AlarmArray::bitOf(alarmCode) & activeMask;
+        if (bit) {
+            acknowledgedMask |= bit;
+            ++modificationCount;
         }
     }
 
     bool isAcknowledged(AlarmCode const &alarmCode) const {
-        return (
-                alarmArray[static_cast<uint8_t>(alarmCode)].isActive()
-                && alarmArray[static_cast<uint8_t>(alarmCode)].isAcknowledged()
-        );
+        return (AlarmArray::bitOf(alarmCode) & activeMask & acknowledgedMask) != 0;
+    }
+
+    bool contains(AlarmCode const &alarmCode) const {
+        return (AlarmArray::bitOf(alarmCode) & activeMask) != 0;
     }
 
-    bool contains(AlarmCode const &alarmCode) {
-        return alarmArray[static_cast<uint8_t>(alarmCode)].isActive();
+    /**
+     * <br/>
+     * Active and not acknowledged.
+     */
+    bool hasPending() const {
+        return (activeMask & ~acknowledgedMask) != 0;
     }
 
-    AlarmArrayElement get(AlarmCode const &alarmCode) {
-        return alarmArray[static_cast<uint8_t>(alarmCode)];
+    uint8_t countPending() const {
+        return AlarmArray::countBits(activeMask & ~acknowledgedMask);
+    }
+
+    uint8_t countWithSeverity(AlarmSeverity const alarmSeverity) const {
+        return AlarmArray::countBits(AlarmArray::severityMask(alarmSeverity));
+    }
+
+    /**
+     * <br/>
+     * Highest severity among pending alarms, <tt>NoSeverity</tt> if none is pending.
+     */
+    AlarmSeverity getHighestPendingSeverity() const {
+        uint32_t pending = activeMask & ~acknowledgedMask;
+        if (pending & severityHighMask) {
+            return pending & severityHighMask & severityLowMask ? AlarmSeverity::Critical : AlarmSeverity::Major;
+        }
+        return pending & severityLowMask ? AlarmSeverity::Minor : AlarmSeverity::NoSeverity;
+    }
+
+    /**
+     * <br/>
+     * Pending alarm with the highest severity, the lowest code on a tie, <tt>NoAlarm</tt> if none is pending.
+     */
+    AlarmCode getHighestPendingAlarm() const {
+        uint32_t pending = activeMask & ~acknowledgedMask;
+        uint32_t candidates = pending & severityHighMask;
+        if (candidates == 0) {
+            candidates = pending;
+        }
+        uint32_t preferred = candidates & severityLowMask;
+        return AlarmArray::lowestCode(preferred != 0 ? preferred : candidates);
+    }
+
+    AlarmSeverity getSeverity(AlarmCode const &alarmCode) const {
+        return AlarmArray::severityOf(AlarmArray::bitOf(alarmCode) & activeMask);
+    }
+
+    uint32_t getLastNotificationMs(AlarmCode const &alarmCode) const {
+        uint8_t index = static_cast<uint8_t>(alarmCode);
+        return index < static_cast<uint8_t>(N) ? lastNotificationMs[index] : 0;
+    }
+
+    void setLastNotificationMs(AlarmCode const &alarmCode, uint32_t const notificationMs) {
+        uint8_t index = static_cast<uint8_t>(alarmCode);
+        if (index < static_cast<uint8_t>(N)) {
+            lastNotificationMs[index] = notificationMs;
+        }
+    }
+
+    /**
+     * <br/>
+     * Calls <tt>action(AlarmCode, AlarmSeverity, uint32_t lastNotificationMs)</tt> for every alarm not acknowledged,
+     * in code order, one count trailing zeros per alarm.
+     */
+    template<typename F>
+    void forEachPending(F action) const {
+        uint32_t pending = activeMask & ~acknowledgedMask;
+        while (pending) {
+            uint8_t index = static_cast<uint8_t>(__builtin_ctzl(pending));
+            pending &= pending - 1;
+            action(static_cast<AlarmCode>(index), AlarmArray::severityOf(1ul << index), lastNotificationMs[index]);
+        }
+    }
+
+    /**
+     * <br/>
+     * Snapshot of one alarm, changes to it are not written back.
+     */
+    AlarmArrayElement get(AlarmCode const &alarmCode) const {
+        uint32_t bit = AlarmArray::bitOf(alarmCode);
+        AlarmArrayElement element{alarmCode, AlarmArray::severityOf(bit)};
+        element.setActive((activeMask & bit) != 0);
+        element.setLastNotificationMs(AlarmArray::getLastNotificationMs(alarmCode));
+        if (acknowledgedMask & bit) {
+            element.acknowledge();
+        }
+        return element;
     }
 };
 
-#endif
\ No newline at end of file
+#endif
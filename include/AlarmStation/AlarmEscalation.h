@@ -0,0 +1,117 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ALARM_STATION_ALARM_ESCALATION_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ALARM_STATION_ALARM_ESCALATION_H_
+#pragma once
+
+#include <stdint.h>
+
+#include "Enums/AlarmCode.h"
+#include "Enums/AlarmSeverity.h"
+
+/**
+ * <br/>
+ * Concrete class, time based severity escalation of unacknowledged alarms.<br/>
+ * The rule table has one entry per severity: an alarm of that severity still unacknowledged
+ * <tt>afterMinutes</tt> after it was raised gets the next severity. Rules chain and all count from the raise,
+ * e.g. Minor to Major after 30 min, Major to Critical after 120 min.<br/>
+ * Raise times are kept per <tt>AlarmCode</tt>, 4 bytes each. The station offers every pending alarm
+ * when it rebuilds its notification queue, only the earliest deadline is cached,
+ * so the loop costs one comparison until something is due.
+ * \code
+ *     AlarmEscalation alarmEscalation{};
+ *     alarmEscalation.setRule(AlarmSeverity::Minor, AlarmSeverity::Major, 30);
+ *     alarmEscalation.setRule(AlarmSeverity::Major, AlarmSeverity::Critical, 120);
+ *     alarmStation.attachEscalation(&alarmEscalation);
+ * \endcode
+ */
+class AlarmEscalation {
+
+private:
+
+    uint32_t afterMs[3] = {};       // <- per AlarmSeverity below Critical, 0 if no rule
+    AlarmSeverity toSeverity[3] = {AlarmSeverity::NoSeverity, AlarmSeverity::NoSeverity, AlarmSeverity::NoSeverity};
+    uint32_t raisedMs[ALARM_CODE_COUNT];
+
+    uint32_t nextDueMs = 0;
+    bool hasDeadline = false;
+
+    uint32_t raisedMsOf(AlarmCode const alarmCode) const {
+        uint8_t index = static_cast<uint8_t>(alarmCode);
+        return index < ALARM_CODE_COUNT ? raisedMs[index] : 0;
+    }
+
+    bool hasRule(AlarmSeverity const fromSeverity) const {
+        uint8_t from = static_cast<uint8_t>(fromSeverity);
+        return from < 3 && afterMs[from] > 0;
+    }
+
+public:
+
+    AlarmEscalation() : raisedMs{} {}
+
+    /**
+     * <br/>
+     * Sets, or with 0 minutes removes, the rule for <tt>fromSeverity</tt>.
+     *
+     * @return <tt>false</tt> if <tt>toSeverity</tt> is not higher
+     */
+    bool setRule(AlarmSeverity const fromSeverity, AlarmSeverity const toSeverity, uint16_t const afterMinutes) {
+        uint8_t from = static_cast<uint8_t>(fromSeverity);
+        if (from >= 3 || static_cast<uint8_t>(toSeverity) <= from) {
+            return false;
+        }
+        afterMs[from] = afterMinutes * 60ul * 1000ul;
+        AlarmEscalation::toSeverity[from] = toSeverity;
+        return true;
+    }
+
+    /**
+     * <br/>
+     * Called by the station when the alarm becomes unacknowledged, starts its escalation time.
+     */
+    void markRaised(AlarmCode const alarmCode, uint32_t const nowMs) {
+        uint8_t index = static_cast<uint8_t>(alarmCode);
+        if (index < ALARM_CODE_COUNT) {
+            raisedMs[index] = nowMs;
+        }
+    }
+
+    /**
+     * <br/>
+     * Severity of the alarm at <tt>nowMs</tt>, every rule due since the raise applied.
+     */
+    AlarmSeverity escalate(AlarmCode const alarmCode, AlarmSeverity alarmSeverity, uint32_t const nowMs) const {
+        uint32_t pendingMs = nowMs - AlarmEscalation::raisedMsOf(alarmCode);
+        while (AlarmEscalation::hasRule(alarmSeverity) &&
+               pendingMs >= afterMs[static_cast<uint8_t>(alarmSeverity)]) {
+            alarmSeverity = toSeverity[static_cast<uint8_t>(alarmSeverity)];
+        }
+        return alarmSeverity;
+    }
+
+    /* § Section: Cached Deadline */
+
+    void clearDeadline() {
+        hasDeadline = false;
+    }
+
+    /**
+     * <br/>
+     * Keeps the earlier of the cached deadline and the next one of the alarm.
+     */
+    void offerDeadline(AlarmCode const alarmCode, AlarmSeverity const alarmSeverity) {
+        if (!AlarmEscalation::hasRule(alarmSeverity)) {
+            return;
+        }
+        uint32_t dueMs = AlarmEscalation::raisedMsOf(alarmCode) + afterMs[static_cast<uint8_t>(alarmSeverity)];
+        if (!hasDeadline || static_cast<int32_t>(dueMs - nextDueMs) < 0) {
+            nextDueMs = dueMs;
+            hasDeadline = true;
+        }
+    }
+
+    bool isDue(uint32_t const nowMs) const {
+        return hasDeadline && static_cast<int32_t>(nowMs - nextDueMs) >= 0;
+    }
+};
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ALARM_STATION_ALARM_EVENT_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ALARM_STATION_ALARM_EVENT_H_
+#pragma once
+
+#include <stdint.h>
+
+#include "Enums/AlarmCode.h"
+#include "Enums/AlarmSeverity.h"
+#include "Enums/AlarmEventType.h"
+
+/**
+ * <br/>
+ * Change of one stored alarm, pushed by <tt>BasicAlarmStation</tt> to its observers, with the severity stored with it.
+ * <ul>
+ * <li><tt>Raised</tt> – added, or un-acknowledged by a new raise</li>
+ * <li><tt>Cleared</tt> – the condition is gone, the alarm stays stored acknowledged</li>
+ * <li><tt>Acknowledged</tt> – by the user, the condition persists</li>
+ * <li><tt>Escalated</tt> – left unacknowledged, <tt>severity</tt> is the new one</li>
+ * <li><tt>Removed</tt> – deleted from the storage</li>
+ * </ul>
+ */
+struct AlarmEvent {
+    AlarmEventType type;
+    AlarmCode code;
+    AlarmSeverity severity;
+};
+
+#endif
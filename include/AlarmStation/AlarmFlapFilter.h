@@ -0,0 +1,214 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ALARM_STATION_ALARM_FLAP_FILTER_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ALARM_STATION_ALARM_FLAP_FILTER_H_
+#pragma once
+
+#include <stdint.h>
+
+#include "Enums/AlarmCode.h"
+#include "Enums/AlarmSeverity.h"
+
+/**
+ * <br/>
+ * Concrete class, rate limits raise / clear reports per <tt>AlarmCode</tt> before they reach the alarm storage.<br/>
+ * Time is counted in slots of <tt>slotMs</tt>, a 32 bit slot counter advanced by elapsed time, so it neither jumps
+ * at the <tt>millis()</tt> rollover nor wraps in the lifetime of the device. Every code keeps a 16 bit history,
+ * bit <tt>n</tt> set if the report changed <tt>n</tt> slots ago, the transitions in the sliding window are a <tt>popcount</tt>.
+ * <ul>
+ * <li>a report is applied at once if the last applied change is older than the hold time,
+ * or nothing was applied yet</li>
+ * <li>otherwise it is deferred to the end of the hold time, a report back to the applied state cancels it</li>
+ * <li>with <tt>flapTransitions</tt> or more in the window the code is flapping, every applied change
+ * then doubles its hold time, up to <tt>minHoldSlots << maxBackoff</tt>, a quiet window resets it</li>
+ * </ul>
+ * So a code changes the storage at most once per hold time, whatever the sensor does. 12 bytes per code.
+ */
+class AlarmFlapFilter {
+
+public:
+
+    static constexpr uint8_t historySlots = 16;
+
+private:
+
+    static constexpr uint8_t appliedFlag = 0x01u;   // <- raised in the storage
+    static constexpr uint8_t reportedFlag = 0x02u;  // <- last report, raised
+    static constexpr uint8_t changedFlag = 0x04u;   // <- a change was applied, changeSlot is valid
+    static constexpr uint8_t severityShift = 4;     // <- 2 bits AlarmSeverity of the last raise
+
+    struct CodeState {
+        uint32_t historySlot;
+        uint32_t changeSlot;
+        uint16_t history;
+        uint8_t backoff;
+        uint8_t flags;
+    };
+
+    CodeState states[ALARM_CODE_COUNT];
+    uint32_t pendingMask = 0;
+    uint32_t slot = 0;
+    uint32_t slotStartMs = 0;
+
+    uint16_t slotMs;
+    uint16_t windowMask;
+    uint8_t flapTransitions;
+    uint8_t minHoldSlots;
+    uint8_t maxBackoff;
+
+    /**
+     * <br/>
+     * Advances the slot counter by the time elapsed since the current slot started,
+     * the unsigned difference keeps it monotonic across the <tt>millis()</tt> rollover.
+     */
+    uint32_t slotOf(uint32_t const nowMs) {
+        uint32_t elapsedMs = nowMs - slotStartMs;
+        if (elapsedMs >= slotMs) {
+            uint32_t elapsedSlots = elapsedMs / slotMs;
+            slot += elapsedSlots;
+            slotStartMs += elapsedSlots * slotMs;
+        }
+        return slot;
+    }
+
+    static void age(CodeState &state, uint32_t const slot) {
+        uint32_t elapsedSlots = slot - state.historySlot;
+        state.history = elapsedSlots >= historySlots ? 0 : static_cast<uint16_t>(state.history << elapsedSlots);
+        state.historySlot = slot;
+    }
+
+    uint16_t holdSlots(CodeState const &state) const {
+        return static_cast<uint16_t>(static_cast<uint16_t>(minHoldSlots) << state.backoff);
+    }
+
+    bool isHeld(CodeState const &state, uint32_t const slot) const {
+        return (state.flags & changedFlag) && slot - state.changeSlot < AlarmFlapFilter::holdSlots(state);
+    }
+
+    void apply(CodeState &state, uint32_t const slot) {
+        AlarmFlapFilter::age(state, slot);
+        bool isFlapping = __builtin_popcount(state.history & windowMask) >= flapTransitions;
+        if (!isFlapping) {
+            state.backoff = 0;
+        } else if ((state.flags & changedFlag) && state.backoff < maxBackoff) {
+            ++state.backoff;
+        }
+        state.flags = static_cast<uint8_t>((state.flags & ~appliedFlag) | changedFlag |
+                                           (state.flags & reportedFlag ? appliedFlag : 0));
+        state.changeSlot = slot;
+    }
+
+public:
+
+    /**
+     * @param slotMs – time resolution, hold and window are counted in slots
+     * @param windowSlots – sliding window for the transition count, 1 .. 16
+     * @param flapTransitions – slots with a transition in the window to count as flapping
+     * @param minHoldSlots – minimum time between applied changes of one code
+     * @param maxBackoff – the hold time doubles at most this many times
+     */
+    explicit AlarmFlapFilter(
+            uint16_t const slotMs = 1000,
+            uint8_t const windowSlots = 16,
+            uint8_t const flapTransitions = 4,
+            uint8_t const minHoldSlots = 5,
+            uint8_t const maxBackoff = 6
+    ) :
+            states{},
+            slotMs(slotMs > 0 ? slotMs : 1),
+            windowMask(static_cast<uint16_t>(windowSlots >= historySlots ? 0xFFFFu : (1u << windowSlots) - 1)),
+            flapTransitions(flapTransitions),
+            minHoldSlots(minHoldSlots),
+            maxBackoff(maxBackoff < 8 ? maxBackoff : 8) {}
+
+    /**
+     * <br/>
+     * Records a change of the reported state.
+     *
+     * @return <tt>true</tt> if the change is to be applied to the storage now,
+     * <tt>false</tt> if it is deferred or cancels a deferred one
+     */
+    bool report(AlarmCode const alarmCode, bool const isRaised, AlarmSeverity const alarmSeverity, uint32_t const nowMs) {
+        uint8_t index = static_cast<uint8_t>(alarmCode);
+        if (index >= ALARM_CODE_COUNT) {
+            return true;
+        }
+        CodeState &state = states[index];
+        uint32_t slot = AlarmFlapFilter::slotOf(nowMs);
+        AlarmFlapFilter::age(state, slot);
+        state.history |= 0x01u;
+        state.flags = static_cast<uint8_t>((state.flags & ~reportedFlag & ~(0x03u << severityShift)) |
+                                           (isRaised ? reportedFlag : 0) |
+                                           ((static_cast<uint8_t>(alarmSeverity) & 0x03u) << severityShift));
+
+        uint32_t bit = 1ul << index;
+        if (((state.flags & appliedFlag) != 0) == isRaised && (state.flags & changedFlag)) {
+            pendingMask &= ~bit; // <- back to the applied state, nothing to do
+            return false;
+        }
+        if (AlarmFlapFilter::isHeld(state, slot)) {
+            pendingMask |= bit;
+            return false;
+        }
+        pendingMask &= ~bit;
+        AlarmFlapFilter::apply(state, slot);
+        return true;
+    }
+
+    /**
+     * <br/>
+     * Forgets the code, e.g. when the alarm is removed, the next report is applied at once.
+     */
+    void reset(AlarmCode const alarmCode) {
+        uint8_t index = static_cast<uint8_t>(alarmCode);
+        if (index < ALARM_CODE_COUNT) {
+            states[index] = CodeState{};
+            pendingMask &= ~(1ul << index);
+        }
+    }
+
+    bool hasDeferred() const {
+        return pendingMask != 0;
+    }
+
+    bool isDeferred(AlarmCode const alarmCode) const {
+        uint8_t index = static_cast<uint8_t>(alarmCode);
+        return index < ALARM_CODE_COUNT && (pendingMask & (1ul << index));
+    }
+
+    /**
+     * <br/>
+     * Current hold time of the code in slots.
+     */
+    uint16_t getHoldSlots(AlarmCode const alarmCode) const {
+        uint8_t index = static_cast<uint8_t>(alarmCode);
+        return index < ALARM_CODE_COUNT ? AlarmFlapFilter::holdSlots(states[index]) : 0;
+    }
+
+    /**
+     * <br/>
+     * Calls <tt>action(AlarmCode, bool isRaised, AlarmSeverity)</tt> for every deferred change whose hold time is over.
+     * Call it every loop, it keeps the slot counter going, costs a subtraction while nothing is deferred.
+     */
+    template<typename F>
+    void forEachDue(uint32_t const nowMs, F action) {
+        uint32_t slot = AlarmFlapFilter::slotOf(nowMs);
+        if (pendingMask == 0) {
+            return;
+        }
+        uint32_t pending = pendingMask;
+        while (pending) {
+            uint8_t index = static_cast<uint8_t>(__builtin_ctzl(pending));
+            pending &= pending - 1;
+            CodeState &state = states[index];
+            if (AlarmFlapFilter::isHeld(state, slot)) {
+                continue;
+            }
+            pendingMask &= ~(1ul << index);
+            AlarmFlapFilter::apply(state, slot);
+            action(static_cast<AlarmCode>(index),
+                   (state.flags & appliedFlag) != 0,
+                   static_cast<AlarmSeverity>((state.flags >> severityShift) & 0x03u));
+        }
+    }
+};
+
+#endif
@@ -7,20 +7,40 @@
 #include <Common/LinkedList.h>
 #include "Alarm.h"
 
+/**
+ * <br/>
+ * Heap allocated alarm storage for <tt>BasicAlarmStation</tt>, one list element per alarm,
+ * unbounded number of alarm codes.<br/>
+ * Every change made through <tt>AlarmList</tt> increments <tt>getModificationCount()</tt>,
+ * observers compare it to resync state derived from the list.
+ */
 class AlarmList : public LinkedList<Alarm> {
+
+    uint16_t modificationCount = 0;
+
 public:
 
+    uint16_t getModificationCount() const {
+        return modificationCount;
+    }
+
     Alarm *getFirst() {
         return &(head->value);
     }
 
+    /**
+     * <br/>
+     * Adds the alarm, or un-acknowledges it and updates its severity if already present.
+     */
     void add(AlarmCode const &alarmCode, AlarmSeverity const &alarmSeverity) {
         Alarm *alarm = get(alarmCode);
         if (alarm == nullptr) {
             LinkedList<Alarm>::add(Alarm{alarmCode, alarmSeverity});
         } else {
             alarm->setAcknowledged(false);
+            alarm->setSeverity(alarmSeverity);
         }
+        ++modificationCount;
     }
 
     void remove(AlarmCode const &alarmCode) {
@@ -31,6 +51,7 @@ public:
                 *tracer = (*tracer)->next;
                 --LinkedList<Alarm>::count;
                 delete pAlarmToDelete;
+                ++modificationCount;
                 break;
             }
             tracer = &(*tracer)->next;
@@ -41,9 +62,20 @@ public:
         Alarm *alarm = get(alarmCode);
         if (alarm != nullptr) {
             alarm->setAcknowledged(acknowledged);
+            ++modificationCount;
         }
     }
 
+    void clear() {
+        LinkedList<Alarm>::clear();
+        ++modificationCount;
+    }
+
+    bool removeAll() {
+        AlarmList::clear();
+        return AlarmList::isEmpty();
+    }
+
     void acknowledge(AlarmCode const &alarmCode) {
         setAcknowledge(alarmCode, true);
     }
@@ -60,6 +92,38 @@ public:
         return get(alarmCode) != nullptr;
     }
 
+    AlarmSeverity getSeverity(AlarmCode const &alarmCode) {
+        Alarm *alarm = get(alarmCode);
+        return alarm != nullptr ? alarm->getSeverity() : AlarmSeverity::NoSeverity;
+    }
+
+    uint32_t getLastNotificationMs(AlarmCode const &alarmCode) {
+        Alarm *alarm = get(alarmCode);
+        return alarm != nullptr ? alarm->getLastNotificationMs() : 0;
+    }
+
+    void setLastNotificationMs(AlarmCode const &alarmCode, uint32_t const notificationMs) {
+        Alarm *alarm = get(alarmCode);
+        if (alarm != nullptr) {
+            alarm->setLastNotificationMs(notificationMs);
+        }
+    }
+
+    /**
+     * <br/>
+     * Calls <tt>action(AlarmCode, AlarmSeverity, uint32_t lastNotificationMs)</tt> for every alarm not acknowledged,
+     * in insertion order.
+     */
+    template<typename F>
+    void forEachPending(F action) {
+        for (Element<Alarm> *pElement = head; pElement; pElement = pElement->getNext()) {
+            Alarm const &alarm = pElement->value;
+            if (!alarm.isAcknowledged()) {
+                action(alarm.getCode(), alarm.getSeverity(), alarm.getLastNotificationMs());
+            }
+        }
+    }
+
     Alarm *get(AlarmCode const &alarmCode) {
         Element<Alarm> **tracer = &head;
         while (*tracer) {
@@ -0,0 +1,123 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ALARM_STATION_ALARM_NOTIFICATION_QUEUE_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ALARM_STATION_ALARM_NOTIFICATION_QUEUE_H_
+#pragma once
+
+#include <stdint.h>
+
+#include "Enums/AlarmCode.h"
+#include "Enums/AlarmSeverity.h"
+
+#ifndef ALARM_NOTIFICATION_QUEUE_SIZE
+#define ALARM_NOTIFICATION_QUEUE_SIZE ALARM_CODE_COUNT // <- one entry per code, never full
+#endif
+
+/**
+ * <br/>
+ * Concrete class, binary min-heap of alarms keyed by the next notification time, no heap allocation.<br/>
+ * Earlier deadline first, on equal deadlines the higher severity first.
+ * Deadlines are compared by signed difference, i.e. correct across the <tt>millis()</tt> roll over
+ * as long as they are less than 24 days apart.<br/>
+ * Entries copy code and severity, they do not point into the alarm storage,
+ * the queue must still be rebuilt whenever the storage changes.<br/>
+ * Both storages hold every code at most once, so with a place per <tt>AlarmCode</tt> every pending alarm is queued.
+ */
+class AlarmNotificationQueue {
+
+public:
+
+    static constexpr uint8_t capacity = ALARM_NOTIFICATION_QUEUE_SIZE;
+
+    static_assert(capacity > 0 && capacity < 128, "ALARM_NOTIFICATION_QUEUE_SIZE must be 1 .. 127");
+    static_assert(capacity >= ALARM_CODE_COUNT, "ALARM_NOTIFICATION_QUEUE_SIZE must hold every AlarmCode");
+
+    struct Entry {
+        uint32_t dueMs;
+        AlarmCode code;
+        AlarmSeverity severity;
+    };
+
+private:
+
+    Entry entries[capacity];
+    uint8_t count = 0;
+
+    static bool isBefore(Entry const &entry, Entry const &other) {
+        int32_t difference = static_cast<int32_t>(entry.dueMs - other.dueMs);
+        if (difference != 0) {
+            return difference < 0;
+        }
+        return static_cast<uint8_t>(entry.severity) > static_cast<uint8_t>(other.severity);
+    }
+
+    void swap(uint8_t const index, uint8_t const other) {
+        Entry entry = entries[index];
+        entries[index] = entries[other];
+        entries[other] = entry;
+    }
+
+public:
+
+    AlarmNotificationQueue() : entries{} {}
+
+    uint8_t size() const {
+        return count;
+    }
+
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    void clear() {
+        count = 0;
+    }
+
+    /**
+     * @return <tt>false</tt> if full
+     */
+    bool push(uint32_t const dueMs, AlarmCode const code, AlarmSeverity const severity) {
+        if (count >= capacity) {
+            return false;
+        }
+        uint8_t index = count++;
+        entries[index] = Entry{dueMs, code, severity};
+        while (index > 0) {
+            uint8_t parent = static_cast<uint8_t>((index - 1) / 2);
+            if (!AlarmNotificationQueue::isBefore(entries[index], entries[parent])) {
+                break;
+            }
+            AlarmNotificationQueue::swap(index, parent);
+            index = parent;
+        }
+        return true;
+    }
+
+    /**
+     * <br/>
+     * Earliest entry, only valid while not empty.
+     */
+    Entry const &peek() const {
+        return entries[0];
+    }
+
+    Entry pop() {
+        Entry head = entries[0];
+        entries[0] = entries[--count];
+        uint8_t index = 0;
+        while (true) {
+            uint8_t first = static_cast<uint8_t>(2 * index + 1);
+            if (first >= count) {
+                break;
+            }
+            uint8_t second = static_cast<uint8_t>(first + 1);
+            uint8_t child = (second < count && AlarmNotificationQueue::isBefore(entries[second], entries[first])) ? second : first;
+            if (!AlarmNotificationQueue::isBefore(entries[child], entries[index])) {
+                break;
+            }
+            AlarmNotificationQueue::swap(index, child);
+            index = child;
+        }
+        return head;
+    }
+};
+
+#endif
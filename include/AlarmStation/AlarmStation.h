@@ -3,118 +3,414 @@
 #pragma once
 
 #include <Common/LinkedMap.h>
-#include <Enums/State.h>
 #include <Abstract/AbstractBuzzer.h>
-#include <Abstract/AbstractSleepable.h>
+#include <Abstract/AbstractObservable.h>
+#include "AbstractAlarmStation.h"
 #include "AlarmList.h"
+#include "AlarmArray.h"
+#include "AlarmNotificationQueue.h"
 #include "AlarmNotifyConfiguration.h"
+#include "AlarmEscalation.h"
+#include "AlarmEvent.h"
 
-class AlarmStation :
-        public AbstractRunnable,
-        public AbstractSleepable {
+#ifndef ALARM_OBSERVER_COUNT
+#define ALARM_OBSERVER_COUNT 4
+#endif
+
+/**
+ * <br/>
+ * Alarm station on top of any alarm storage, the storage is a member, calls to it are not virtual.<br/>
+ * Unacknowledged alarms wait in <tt>AlarmNotificationQueue</tt> ordered by their next notification time,
+ * a free buzzer only looks at the queue head, a busy one only with pattern notifications. The queue, and the notify configurations expanded per severity,
+ * are rebuilt when the storage reports a modification.<br/>
+ * An attached <tt>AlarmEscalation</tt> raises the severity of alarms left unacknowledged, its earliest deadline
+ * is found while rebuilding the queue, the loop only compares against it.<br/>
+ * Every change of a stored alarm is pushed as an <tt>AlarmEvent</tt> to up to <tt>ALARM_OBSERVER_COUNT</tt>
+ * registered observers, LEDs or displays update on change and never walk <tt>alarmList</tt>.
+ * Changes made directly through <tt>alarmList</tt> are found by its modification count, before the next change of
+ * the station or in the next loop, and published by comparing every code against the last published state.
+ * Observers must not register or unregister from <tt>update()</tt>.<br/>
+ * Storage concept, <tt>AlarmList</tt> (heap, any number of codes) and <tt>AlarmArray<N></tt> (bit masks, no heap) model it:
+ * <ul>
+ * <li><tt>void add(AlarmCode, AlarmSeverity)</tt>, un-acknowledges an alarm already present and updates its severity</li>
+ * <li><tt>void remove(AlarmCode)</tt></li>
+ * <li><tt>void acknowledge(AlarmCode)</tt></li>
+ * <li><tt>bool contains(AlarmCode)</tt>, <tt>bool isAcknowledged(AlarmCode)</tt>, <tt>size()</tt>, <tt>bool isEmpty()</tt></li>
+ * <li><tt>AlarmSeverity getSeverity(AlarmCode)</tt>, <tt>NoSeverity</tt> if not stored</li>
+ * <li><tt>uint16_t getModificationCount()</tt>, incremented by every change</li>
+ * <li><tt>uint32_t getLastNotificationMs(AlarmCode)</tt>, <tt>void setLastNotificationMs(AlarmCode, uint32_t)</tt></li>
+ * <li><tt>void forEachPending(F action)</tt>, calls <tt>action(AlarmCode, AlarmSeverity, uint32_t lastNotificationMs)</tt>
+ * for every alarm not acknowledged</li>
+ * </ul>
+ *
+ * @tparam S – alarm storage, see the concept above
+ */
+template<typename S>
+class BasicAlarmStation :
+        public AbstractAlarmStation,
+        public AbstractObservable<AlarmEvent> {
 
     AbstractBuzzer &buzzer;
     LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> &alarmNotifyConfigurations;
 
-    State alarmStationState = State::Active;
-
     AlarmNotifyConfiguration defaultConfiguration{5, 5000};
 
+    AlarmNotificationQueue notificationQueue;
+    uint16_t queuedModificationCount = 0;
+    bool isQueueSynced = false;
+    bool isPlayingPatterns = false;
+    uint32_t soundPeriodMs[4] = {};     // <- per AlarmSeverity
+    uint16_t soundDurationMs[4] = {};   // <- per AlarmSeverity
+
+    AlarmEscalation *pEscalation = nullptr;
+
+    AbstractObserver<AlarmEvent> *observers[ALARM_OBSERVER_COUNT] = {};
+    uint8_t observerCount = 0;
+    AlarmEvent lastEvent{AlarmEventType::Removed, AlarmCode::NoAlarm, AlarmSeverity::NoSeverity};
+
+    /* last published state of every code, bit n is code n */
+    uint32_t publishedStoredMask = 0;
+    uint32_t publishedAcknowledgedMask = 0;
+    uint32_t publishedSeverityLowMask = 0;
+    uint32_t publishedSeverityHighMask = 0;
+    uint16_t publishedModificationCount = 0;
+
 public:
 
-    AlarmList alarmList;
+    S alarmList;
 
-    explicit AlarmStation(
+    explicit BasicAlarmStation(
             AbstractBuzzer &buzzer,
             LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> &alarmNotifyConfigurations
     ) :
             buzzer(buzzer),
             alarmNotifyConfigurations(alarmNotifyConfigurations) {}
 
-    /* § Section: State Methods */
+    /**
+     * <br/>
+     * Sound <tt>BuzzerPattern::forAlarm</tt> instead of the configured duration, the alarm can be told by ear.<br/>
+     * A due alarm then preempts the pattern of a less severe one, the configured periods still apply.
+     */
+    void setPatternNotifications(bool const enabled) {
+        isPlayingPatterns = enabled;
+    }
 
-    void setState(State const newStationState) {
-        alarmStationState = newStationState;
+    /**
+     * <br/>
+     * Escalates unacknowledged alarms by the rules of <tt>pAlarmEscalation</tt>, <tt>nullptr</tt> detaches.
+     * Alarms already pending escalate from the time of attaching.
+     */
+    void attachEscalation(AlarmEscalation *const pAlarmEscalation) {
+        pEscalation = pAlarmEscalation;
+        if (pEscalation != nullptr) {
+            uint32_t nowMs = millis();
+            alarmList.forEachPending([this, nowMs](AlarmCode const alarmCode, AlarmSeverity const, uint32_t const) {
+                pEscalation->markRaised(alarmCode, nowMs);
+            });
+        }
+        isQueueSynced = false;
     }
 
-    State const &getState() const {
-        return alarmStationState;
+    /**
+     * <br/>
+     * Acknowledged by the user, the buzzer stops notifying it while the condition persists.
+     * A new raise after the condition cleared un-acknowledges it.
+     */
+    void acknowledge(AlarmCode const alarmCode) {
+        BasicAlarmStation::publishStorageChanges();
+        if (!alarmList.contains(alarmCode) || alarmList.isAcknowledged(alarmCode)) {
+            return;
+        }
+        alarmList.acknowledge(alarmCode);
+        BasicAlarmStation::publish(AlarmEventType::Acknowledged, alarmCode);
     }
 
-    bool isInState(State const &compareState) const {
-        return alarmStationState == compareState;
+    /* § Section: AbstractObservable Methods */
+
+    /**
+     * <br/>
+     * Ignored if already registered or all <tt>ALARM_OBSERVER_COUNT</tt> places are taken.
+     */
+    void registerObserver(AbstractObserver<AlarmEvent> &observer) override {
+        if (observerCount >= ALARM_OBSERVER_COUNT || BasicAlarmStation::isRegistered(observer)) {
+            return;
+        }
+        observers[observerCount++] = &observer;
     }
 
-    /* § Section: ISleepable Methods */
+    void unregisterObserver(AbstractObserver<AlarmEvent> &observer) override {
+        for (uint8_t index = 0; index < observerCount; ++index) {
+            if (observers[index] == &observer) {
+                for (; index + 1 < observerCount; ++index) {
+                    observers[index] = observers[index + 1]; // <- keeps the notify order
+                }
+                observers[--observerCount] = nullptr;
+                return;
+            }
+        }
+    }
 
-    void startSleeping(uint32_t const &sleepMs) override {
-        AbstractSleepable::startSleeping(sleepMs);
-        AlarmStation::setState(State::Sleeping);
-        buzzer.stop();
+    /**
+     * <br/>
+     * Pushes the last pushed event again, e.g. to a display after a reset.
+     */
+    void notifyObservers() const override {
+        for (uint8_t index = 0; index < observerCount; ++index) {
+            observers[index]->update(lastEvent);
+        }
     }
 
-    void stopSleeping() override {
-        AbstractSleepable::stopSleeping();
-        AlarmStation::setState(State::Active);
+    bool isRegistered(AbstractObserver<AlarmEvent> const &observer) const {
+        for (uint8_t index = 0; index < observerCount; ++index) {
+            if (observers[index] == &observer) {
+                return true;
+            }
+        }
+        return false;
     }
 
-    /* § Section: Runnable Methods */
+    uint8_t getObserverCount() const {
+        return observerCount;
+    }
+
+    /* § Section: ISleepable Methods */
 
-    void setup() override {
-        // pass
+    void startSleeping(uint32_t const &sleepMs) override {
+        AbstractAlarmStation::startSleeping(sleepMs);
+        buzzer.stop();
     }
 
+    /* § Section: Runnable Methods */
+
     void loop() override {
 #ifdef __SERIAL_DEBUG__
         Serial << "------------------------------------------------\n";
         Serial << "AlarmStation::alarmList::size()\t\t" << static_cast<int>(alarmList.size()) << "\n";
-        alarmList.forEach([](Alarm alarm) {
-            Serial << "\t\t" << getAlarmCodeString(alarm) << "\tack:" << static_cast<int>(alarm.isAcknowledged()) << "\n";
+        alarmList.forEachPending([](AlarmCode const alarmCode, AlarmSeverity const, uint32_t const) {
+            Serial << "\t\t" << getAlarmCodeString(alarmCode) << "\n";
         });
         Serial << "------------------------------------------------\n";
 #endif
-        if (AlarmStation::isInState(State::Sleeping)) {
+        BasicAlarmStation::publishStorageChanges();
+
+        if (BasicAlarmStation::isInState(State::Sleeping)) {
             if (AbstractSleepable::shouldStopSleeping()) {
-                AlarmStation::stopSleeping();
+                BasicAlarmStation::stopSleeping();
             } else {
                 return;
             }
         }
 
-        if (!buzzer.isBusy()) {
-            for (Element<Alarm> *pElement = alarmList.getFirstElement(); pElement; pElement = pElement->getNext()) {
-                if (!(pElement->value.isAcknowledged())) {
-                    //
-                    uint32_t soundPeriodMs = alarmNotifyConfigurations
-                            .getOrDefault(pElement->value.getSeverity(), defaultConfiguration)
-                            .getSoundPeriodMinutes();
+        AbstractAlarmStation::applyDeferredReports();
+
+        if (!isQueueSynced || queuedModificationCount != alarmList.getModificationCount()) {
+            BasicAlarmStation::rebuildNotificationQueue();
+        }
+
+        uint32_t nowMs = millis();
+        if (pEscalation != nullptr && pEscalation->isDue(nowMs)) {
+            BasicAlarmStation::escalateDueAlarms(nowMs);
+            BasicAlarmStation::rebuildNotificationQueue();
+        }
+
+        if (notificationQueue.isEmpty()) {
+            return;
+        }
+
+        AlarmNotificationQueue::Entry const &head = notificationQueue.peek();
+        if (static_cast<int32_t>(nowMs - head.dueMs) < 0) {
+            return;
+        }
+
+        if (buzzer.isBusy() &&
+            !(isPlayingPatterns && static_cast<uint8_t>(head.severity) > buzzer.getPriority())) {
+            return;
+        }
+
+        AlarmNotificationQueue::Entry entry = notificationQueue.pop();
+        uint8_t severity = static_cast<uint8_t>(entry.severity) & 0x03u;
+        alarmList.setLastNotificationMs(entry.code, nowMs);
+        if (isPlayingPatterns) {
+            buzzer.play(BuzzerPattern::forAlarm(entry.code, entry.severity), severity);
+        } else {
+            buzzer.buzz(soundDurationMs[severity]);
+        }
+        notificationQueue.push(nowMs + soundPeriodMs[severity] + 1, entry.code, entry.severity); // <- strictly after the period, as before
+    }
+
+protected:
+
+    void addAlarm(AlarmCode const alarmCode, AlarmSeverity const alarmSeverity) override {
+        BasicAlarmStation::publishStorageChanges();
+        if (pEscalation != nullptr && !(alarmList.contains(alarmCode) && !alarmList.isAcknowledged(alarmCode))) {
+            pEscalation->markRaised(alarmCode, millis());
+        }
+        alarmList.add(alarmCode, alarmSeverity);
+        BasicAlarmStation::publish(AlarmEventType::Raised, alarmCode);
+    }
+
+    void acknowledgeAlarm(AlarmCode const alarmCode) override {
+        BasicAlarmStation::publishStorageChanges();
+        if (!alarmList.contains(alarmCode)) {
+            return;
+        }
+        alarmList.acknowledge(alarmCode);
+        BasicAlarmStation::publish(AlarmEventType::Cleared, alarmCode);
+    }
+
+    void deleteAlarm(AlarmCode const alarmCode) override {
+        BasicAlarmStation::publishStorageChanges();
+        if (!alarmList.contains(alarmCode)) {
+            return;
+        }
+        AlarmSeverity alarmSeverity = alarmList.getSeverity(alarmCode);
+        alarmList.remove(alarmCode);
+        BasicAlarmStation::markPublished(alarmCode);
+        BasicAlarmStation::publish(AlarmEventType::Removed, alarmCode, alarmSeverity);
+    }
+
+private:
+
+    /**
+     * <br/>
+     * Queues every unacknowledged alarm, the queue has a place for every code.
+     */
+    void rebuildNotificationQueue() {
+        for (uint8_t severity = 0; severity < 4; ++severity) {
+            AlarmNotifyConfiguration const &configuration =
+                    alarmNotifyConfigurations.getOrDefault(static_cast<AlarmSeverity>(severity), defaultConfiguration);
+            soundPeriodMs[severity] = configuration.getSoundPeriodMinutes() * 60ul * 1000ul;
+            soundDurationMs[severity] = configuration.getSoundDurationMs();
+        }
+
+        notificationQueue.clear();
+        if (pEscalation != nullptr) {
+            pEscalation->clearDeadline();
+        }
+        uint32_t nowMs = millis();
+        for (int8_t severity = 3; severity >= 0; --severity) {
+            alarmList.forEachPending([this, severity, nowMs](AlarmCode const alarmCode, AlarmSeverity const alarmSeverity, uint32_t const lastNotificationMs) {
+                if (static_cast<int8_t>(alarmSeverity) != severity) {
+                    return;
+                }
+                if (pEscalation != nullptr) {
+                    pEscalation->offerDeadline(alarmCode, alarmSeverity);
+                }
+                notificationQueue.push(
+                        lastNotificationMs == 0 ? nowMs : lastNotificationMs + soundPeriodMs[severity] + 1,
+                        alarmCode,
+                        alarmSeverity);
+            });
+        }
 
-                    soundPeriodMs = soundPeriodMs * 60 * 1000ul; /* expand minutes to milliseconds */
+        queuedModificationCount = alarmList.getModificationCount();
+        isQueueSynced = true;
+    }
 
-                    uint32_t lastNotificationMs = pElement->value.getLastNotificationMs();
+    /**
+     * <br/>
+     * Re-adds every pending alarm whose escalation is due with its new severity and notifies it at once,
+     * collected first, the storage is not modified while iterated.
+     */
+    void escalateDueAlarms(uint32_t const nowMs) {
+        BasicAlarmStation::publishStorageChanges();
+        uint32_t escalatedMasks[4] = {}; // <- per new AlarmSeverity, bit n is code n
+        alarmList.forEachPending([this, nowMs, &escalatedMasks](AlarmCode const alarmCode, AlarmSeverity const alarmSeverity, uint32_t const) {
+            AlarmSeverity escalatedSeverity = pEscalation->escalate(alarmCode, alarmSeverity, nowMs);
+            if (escalatedSeverity != alarmSeverity) {
+                escalatedMasks[static_cast<uint8_t>(escalatedSeverity) & 0x03u] |= 1ul << static_cast<uint8_t>(alarmCode);
+            }
+        });
+        for (uint8_t severity = 0; severity < 4; ++severity) {
+            uint32_t escalated = escalatedMasks[severity];
+            while (escalated) {
+                uint8_t index = static_cast<uint8_t>(__builtin_ctzl(escalated));
+                escalated &= escalated - 1;
+                alarmList.add(static_cast<AlarmCode>(index), static_cast<AlarmSeverity>(severity));
+                alarmList.setLastNotificationMs(static_cast<AlarmCode>(index), 0); // <- sound the new severity now
+                BasicAlarmStation::publish(AlarmEventType::Escalated, static_cast<AlarmCode>(index));
+            }
+        }
+    }
 
-                    if (lastNotificationMs == 0 || (millis() - lastNotificationMs > soundPeriodMs)) {
-                        //
-                        pElement->value.setLastNotificationMs(millis());
+    /**
+     * <br/>
+     * Records the stored state of the code as published, called after every change made by the station.
+     */
+    void markPublished(AlarmCode const alarmCode) {
+        uint8_t index = static_cast<uint8_t>(alarmCode);
+        if (index >= ALARM_CODE_COUNT) {
+            return;
+        }
+        uint32_t bit = 1ul << index;
+        bool isStored = alarmList.contains(alarmCode);
+        uint8_t severity = static_cast<uint8_t>(alarmList.getSeverity(alarmCode));
+        publishedStoredMask = isStored ? publishedStoredMask | bit : publishedStoredMask & ~bit;
+        publishedAcknowledgedMask = isStored && alarmList.isAcknowledged(alarmCode) ?
+                                    publishedAcknowledgedMask | bit : publishedAcknowledgedMask & ~bit;
+        publishedSeverityLowMask = severity & 0x01u ? publishedSeverityLowMask | bit : publishedSeverityLowMask & ~bit;
+        publishedSeverityHighMask = severity & 0x02u ? publishedSeverityHighMask | bit : publishedSeverityHighMask & ~bit;
+        publishedModificationCount = alarmList.getModificationCount();
+    }
 
-                        buzzer.buzz(alarmNotifyConfigurations
-                                            .getOrDefault(pElement->value.getSeverity(), defaultConfiguration)
-                                            .getSoundDurationMs()
-                        );
+    /**
+     * <br/>
+     * Publishes the changes made directly through <tt>alarmList</tt>, one test while there are none.
+     * A stored code that is gone is <tt>Removed</tt>, a new or un-acknowledged one, or one with a new severity,
+     * is <tt>Raised</tt>, one turned acknowledged is <tt>Acknowledged</tt>.
+     */
+    void publishStorageChanges() {
+        if (publishedModificationCount == alarmList.getModificationCount()) {
+            return;
+        }
+        for (uint8_t index = 0; index < ALARM_CODE_COUNT; ++index) {
+            AlarmCode alarmCode = static_cast<AlarmCode>(index);
+            uint32_t bit = 1ul << index;
+            bool wasStored = (publishedStoredMask & bit) != 0;
+            bool wasAcknowledged = (publishedAcknowledgedMask & bit) != 0;
+            AlarmSeverity publishedSeverity = static_cast<AlarmSeverity>(
+                    (publishedSeverityLowMask & bit ? 0x01u : 0) | (publishedSeverityHighMask & bit ? 0x02u : 0));
 
-                        break;
-                    }
+            if (!alarmList.contains(alarmCode)) {
+                if (wasStored) {
+                    BasicAlarmStation::markPublished(alarmCode);
+                    BasicAlarmStation::publish(AlarmEventType::Removed, alarmCode, publishedSeverity);
                 }
+                continue;
+            }
+            bool isAcknowledged = alarmList.isAcknowledged(alarmCode);
+            AlarmSeverity severity = alarmList.getSeverity(alarmCode);
+            BasicAlarmStation::markPublished(alarmCode);
+            if (!wasStored || (!isAcknowledged && (wasAcknowledged || severity != publishedSeverity))) {
+                BasicAlarmStation::publish(AlarmEventType::Raised, alarmCode, severity);
+            }
+            if (isAcknowledged && (!wasStored || !wasAcknowledged)) {
+                BasicAlarmStation::publish(AlarmEventType::Acknowledged, alarmCode, severity);
             }
         }
+        publishedModificationCount = alarmList.getModificationCount();
     }
 
-private:
+    void publish(AlarmEventType const eventType, AlarmCode const alarmCode, AlarmSeverity const alarmSeverity) {
+        if (observerCount == 0) {
+            return;
+        }
+        lastEvent = AlarmEvent{eventType, alarmCode, alarmSeverity};
+        BasicAlarmStation::notifyObservers();
+    }
+
+    void publish(AlarmEventType const eventType, AlarmCode const alarmCode) {
+        BasicAlarmStation::markPublished(alarmCode);
+        if (observerCount == 0) {
+            return;
+        }
+        BasicAlarmStation::publish(eventType, alarmCode, alarmList.getSeverity(alarmCode));
+    }
 
 #ifdef __SERIAL_DEBUG__
 
-    static const char *getAlarmCodeString(const Alarm alarm) {
-        switch (alarm.getCode()) {
+    static const char *getAlarmCodeString(AlarmCode const alarmCode) {
+        switch (alarmCode) {
             case AlarmCode::AmbientMaxTemperatureReached:
                 return "AmbientMaxTemperatureReached";
             case AlarmCode::AmbientMaxHumidityReached:
@@ -133,6 +429,32 @@ private:
                 return "AtoHighLevel";
             case AlarmCode::AtoLowLevel:
                 return "AtoLowLevel";
+            case AlarmCode::Ato2TopOffFailed:
+                return "Ato2TopOffFailed";
+            case AlarmCode::Ato2HighLevel:
+                return "Ato2HighLevel";
+            case AlarmCode::Ato2LowLevel:
+                return "Ato2LowLevel";
+            case AlarmCode::Ato3TopOffFailed:
+                return "Ato3TopOffFailed";
+            case AlarmCode::Ato3HighLevel:
+                return "Ato3HighLevel";
+            case AlarmCode::Ato3LowLevel:
+                return "Ato3LowLevel";
+            case AlarmCode::Ato4TopOffFailed:
+                return "Ato4TopOffFailed";
+            case AlarmCode::Ato4HighLevel:
+                return "Ato4HighLevel";
+            case AlarmCode::Ato4LowLevel:
+                return "Ato4LowLevel";
+            case AlarmCode::AmbientHumiditySensorFault:
+                return "AmbientHumiditySensorFault";
+            case AlarmCode::AmbientTemperatureSensorFault:
+                return "AmbientTemperatureSensorFault";
+            case AlarmCode::SystemTemperatureSensorFault:
+                return "SystemTemperatureSensorFault";
+            case AlarmCode::WaterTemperatureSensorFault:
+                return "WaterTemperatureSensorFault";
             case AlarmCode::NoAlarm:
                 return "NoAlarm";
 
@@ -144,4 +466,16 @@ private:
 #endif
 };
 
-#endif
\ No newline at end of file
+/**
+ * <br/>
+ * Heap allocated storage, the default.
+ */
+using AlarmStation = BasicAlarmStation<AlarmList>;
+
+/**
+ * <br/>
+ * Fixed storage, no heap, every <tt>AlarmCode</tt> has its bits and timestamp.
+ */
+using FixedAlarmStation = BasicAlarmStation<AlarmArray<ALARM_CODE_COUNT>>;
+
+#endif
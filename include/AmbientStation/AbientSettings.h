@@ -2,27 +2,30 @@
 #define _AQUARIUM_CONTROLLER_INCLUDE_AMBIENT_STATION_AMBIENT_SETTINGS_H_
 #pragma once
 
+#include <Common/Centi.h>
+
 /**
  * <br/>
  * Business logic uses no measurement units.<br/>
- * Measurement units (°C or °F) depend on concrete <tt>Sensor</tt> implementation.
+ * Measurement units (°C or °F) depend on concrete <tt>Sensor</tt> implementation.<br/>
+ * Thresholds are fixed-point <tt>Centi</tt>, hundredths of the measurement unit.
  */
 struct AmbientSettings {
 
-    float stopWaterHeatingAtTemperature = 24.4;
-    float startWaterCoolingAtTemperature = 25.6;
-    float startSystemFanAtTemperature = 48;
-    float startAmbientFanAtTemperature = 36;
-    float startAmbientFanAtHumidity = 64;
+    Centi stopWaterHeatingAtTemperature = Centi::fromFloat(24.4f);
+    Centi startWaterCoolingAtTemperature = Centi::fromFloat(25.6f);
+    Centi startSystemFanAtTemperature = Centi::fromWhole(48);
+    Centi startAmbientFanAtTemperature = Centi::fromWhole(36);
+    Centi startAmbientFanAtHumidity = Centi::fromWhole(64);
 
     bool isWaterHeatingEnabled = true;
     bool isWaterCoolingEnabled = true;
 
-    float waterMinTemperatureAlarmTrigger = 22;
-    float waterMaxTemperatureAlarmTrigger = 28;
-    float systemMaxTemperatureAlarmTrigger = 46;
-    float ambientMaxTemperatureAlarmTrigger = 32;
-    float ambientMaxHumidityAlarmTrigger = 90;
+    Centi waterMinTemperatureAlarmTrigger = Centi::fromWhole(22);
+    Centi waterMaxTemperatureAlarmTrigger = Centi::fromWhole(28);
+    Centi systemMaxTemperatureAlarmTrigger = Centi::fromWhole(46);
+    Centi ambientMaxTemperatureAlarmTrigger = Centi::fromWhole(32);
+    Centi ambientMaxHumidityAlarmTrigger = Centi::fromWhole(90);
 
 
     /* § Section: Constructors */
@@ -30,11 +33,11 @@ struct AmbientSettings {
     AmbientSettings() = default;
 
     AmbientSettings(
-            float stopWaterHeatingAtTemperature,
-            float startWaterCoolingAtTemperature,
-            float startSystemFanAtTemperature,
-            float startAmbientFanAtTemperature,
-            float startAmbientFanAtHumidity,
+            Centi stopWaterHeatingAtTemperature,
+            Centi startWaterCoolingAtTemperature,
+            Centi startSystemFanAtTemperature,
+            Centi startAmbientFanAtTemperature,
+            Centi startAmbientFanAtHumidity,
             bool isWaterHeatingControlEnabled,
             bool isWaterCoolingControlEnabled
     ) :
@@ -49,43 +52,43 @@ struct AmbientSettings {
 
     /* § Section: Getters and Setters */
 
-    float getStopWaterHeatingAtTemperature() const {
+    Centi getStopWaterHeatingAtTemperature() const {
         return stopWaterHeatingAtTemperature;
     }
 
-    void setStopWaterHeatingAtTemperature(float stopWaterHeatingAtTemperature) {
+    void setStopWaterHeatingAtTemperature(Centi stopWaterHeatingAtTemperature) {
         AmbientSettings::stopWaterHeatingAtTemperature = stopWaterHeatingAtTemperature;
     }
 
-    float getStartWaterCoolingAtTemperature() const {
+    Centi getStartWaterCoolingAtTemperature() const {
         return startWaterCoolingAtTemperature;
     }
 
-    void setStartWaterCoolingAtTemperature(float startWaterCoolingAtTemperature) {
+    void setStartWaterCoolingAtTemperature(Centi startWaterCoolingAtTemperature) {
         AmbientSettings::startWaterCoolingAtTemperature = startWaterCoolingAtTemperature;
     }
 
-    float getStartSystemFanAtTemperature() const {
+    Centi getStartSystemFanAtTemperature() const {
         return startSystemFanAtTemperature;
     }
 
-    void setStartSystemFanAtTemperature(float startSystemFanAtTemperature) {
+    void setStartSystemFanAtTemperature(Centi startSystemFanAtTemperature) {
         AmbientSettings::startSystemFanAtTemperature = startSystemFanAtTemperature;
     }
 
-    float getStartAmbientFanAtTemperature() const {
+    Centi getStartAmbientFanAtTemperature() const {
         return startAmbientFanAtTemperature;
     }
 
-    void setStartAmbientFanAtTemperature(float startAmbientFanAtTemperature) {
+    void setStartAmbientFanAtTemperature(Centi startAmbientFanAtTemperature) {
         AmbientSettings::startAmbientFanAtTemperature = startAmbientFanAtTemperature;
     }
 
-    float getStartAmbientFanAtHumidity() const {
+    Centi getStartAmbientFanAtHumidity() const {
         return startAmbientFanAtHumidity;
     }
 
-    void setStartAmbientFanAtHumidity(float startAmbientFanAtHumidity) {
+    void setStartAmbientFanAtHumidity(Centi startAmbientFanAtHumidity) {
         AmbientSettings::startAmbientFanAtHumidity = startAmbientFanAtHumidity;
     }
 
@@ -105,43 +108,43 @@ struct AmbientSettings {
         AmbientSettings::isWaterCoolingEnabled = isWaterCoolingEnabled;
     }
 
-    float getWaterMinTemperatureAlarmTrigger() const {
+    Centi getWaterMinTemperatureAlarmTrigger() const {
         return waterMinTemperatureAlarmTrigger;
     }
 
-    void setWaterMinTemperatureAlarmTrigger(float waterMinTemperatureAlarmTrigger) {
+    void setWaterMinTemperatureAlarmTrigger(Centi waterMinTemperatureAlarmTrigger) {
         AmbientSettings::waterMinTemperatureAlarmTrigger = waterMinTemperatureAlarmTrigger;
     }
 
-    float getWaterMaxTemperatureAlarmTrigger() const {
+    Centi getWaterMaxTemperatureAlarmTrigger() const {
         return waterMaxTemperatureAlarmTrigger;
     }
 
-    void setWaterMaxTemperatureAlarmTrigger(float waterMaxTemperatureAlarmTrigger) {
+    void setWaterMaxTemperatureAlarmTrigger(Centi waterMaxTemperatureAlarmTrigger) {
         AmbientSettings::waterMaxTemperatureAlarmTrigger = waterMaxTemperatureAlarmTrigger;
     }
 
-    float getSystemMaxTemperatureAlarmTrigger() const {
+    Centi getSystemMaxTemperatureAlarmTrigger() const {
         return systemMaxTemperatureAlarmTrigger;
     }
 
-    void setSystemMaxTemperatureAlarmTrigger(float systemMaxTemperatureAlarmTrigger) {
+    void setSystemMaxTemperatureAlarmTrigger(Centi systemMaxTemperatureAlarmTrigger) {
         AmbientSettings::systemMaxTemperatureAlarmTrigger = systemMaxTemperatureAlarmTrigger;
     }
 
-    float getAmbientMaxTemperatureAlarmTrigger() const {
+    Centi getAmbientMaxTemperatureAlarmTrigger() const {
         return ambientMaxTemperatureAlarmTrigger;
     }
 
-    void setAmbientMaxTemperatureAlarmTrigger(float ambientMaxTemperatureAlarmTrigger) {
+    void setAmbientMaxTemperatureAlarmTrigger(Centi ambientMaxTemperatureAlarmTrigger) {
         AmbientSettings::ambientMaxTemperatureAlarmTrigger = ambientMaxTemperatureAlarmTrigger;
     }
 
-    float getAmbientMaxHumidityAlarmTrigger() const {
+    Centi getAmbientMaxHumidityAlarmTrigger() const {
         return ambientMaxHumidityAlarmTrigger;
     }
 
-    void setAmbientMaxHumidityAlarmTrigger(float ambientMaxHumidityAlarmTrigger) {
+    void setAmbientMaxHumidityAlarmTrigger(Centi ambientMaxHumidityAlarmTrigger) {
         AmbientSettings::ambientMaxHumidityAlarmTrigger = ambientMaxHumidityAlarmTrigger;
     }
 };
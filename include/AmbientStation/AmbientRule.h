@@ -0,0 +1,70 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_AMBIENT_STATION_AMBIENT_RULE_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_AMBIENT_STATION_AMBIENT_RULE_H_
+#pragma once
+
+#include <stdint.h>
+#include <Common/Centi.h>
+#include <Common/HysteresisSwitch.h>
+#include <Enums/AlarmCode.h>
+#include <Enums/AlarmSeverity.h>
+#include <Enums/AmbientActuator.h>
+#include <Enums/AmbientInput.h>
+#include <Enums/Comparator.h>
+
+/**
+ * <br/>
+ * Plain data, one row of the <tt>AmbientStation</tt> rule table (13 bytes on AVR, 14 with the padding of 16-bit aligned targets).<br/>
+ * Trivially copyable, so the table can live in RAM, PROGMEM or EEPROM.<br/>
+ * <ul>
+ * <li><tt>Comparator::Above</tt> – actuator on at <tt>input ≥ threshold</tt>, off below <tt>threshold - hysteresis</tt>,
+ * alarm at <tt>input > alarmThreshold</tt></li>
+ * <li><tt>Comparator::Below</tt> – actuator on at <tt>input < threshold</tt>, off at <tt>threshold + hysteresis</tt> and above,
+ * alarm at <tt>input < alarmThreshold</tt></li>
+ * </ul>
+ * Use <tt>AmbientActuator::None</tt> for alarm only rules and <tt>AlarmCode::NoAlarm</tt> for rules without alarm.
+ * \code
+ *     const AmbientRule rules[] PROGMEM = {
+ *             {AmbientInput::WaterTemperature, Comparator::Below, Centi::fromFloat(24.4f), Centi::fromFloat(0.2f),
+ *              AmbientActuator::WaterHeater, 30, 30,
+ *              Centi::fromWhole(22), AlarmCode::WaterMinTemperatureReached, AlarmSeverity::Major},
+ *     };
+ * \endcode
+ */
+struct AmbientRule {
+    AmbientInput input;
+    Comparator comparator;
+    Centi threshold;
+    Centi hysteresis;
+    AmbientActuator actuator;
+    uint8_t minOnSeconds;
+    uint8_t minOffSeconds;
+    Centi alarmThreshold;
+    AlarmCode alarmCode;
+    AlarmSeverity alarmSeverity;
+
+    /**
+     * @param value – current input value
+     * @param wasDemanding – previous result, selects the hysteresis side
+     * @return <tt>true</tt> if the rule wants the actuator on
+     */
+    bool isDemanding(Centi const value, bool const wasDemanding) const {
+        bool isAbove = comparator == Comparator::Above;
+        Centi offThreshold = isAbove ? threshold - hysteresis : threshold + hysteresis;
+        return HysteresisSwitch::isDemanding(value, threshold, offThreshold, isAbove, wasDemanding);
+    }
+
+    bool isAlarming(Centi const value) const {
+        if (comparator == Comparator::Above) {
+            return value > alarmThreshold;
+        }
+        return value < alarmThreshold;
+    }
+};
+
+#ifdef __AVR__
+static_assert(sizeof(AmbientRule) == 13, "AmbientRule is packed on AVR");
+#else
+static_assert(sizeof(AmbientRule) == 14, "AmbientRule pads alarmThreshold to 16-bit alignment");
+#endif
+
+#endif
@@ -9,17 +9,59 @@
 
 #endif
 
+#ifdef __AVR__
+
+#include <avr/pgmspace.h>
+
+#endif
+
+#include <Common/Centi.h>
 #include <Common/FunctionList.h>
+#include <Common/HysteresisSwitch.h>
+#include <Common/Sensor.h>
+#include <Common/Switchable.h>
+#include <Enums/AmbientActuator.h>
+#include <Enums/AmbientInput.h>
+#include <Enums/ReadingQuality.h>
 #include <Enums/State.h>
+#include <Enums/Switched.h>
 #include <Abstract/AbstractRunnable.h>
 #include <Abstract/AbstractSleepable.h>
-#include <AlarmStation/AlarmStation.h>
+#include <AlarmStation/AbstractAlarmStation.h>
 #include "AbientSettings.h"
+#include "AmbientRule.h"
+
+#ifndef AMBIENT_STATION_MAX_RULES
+#define AMBIENT_STATION_MAX_RULES 16
+#endif
+
+static_assert(AMBIENT_STATION_MAX_RULES <= 32, "rule states are kept in a 32-bit mask");
+static_assert(static_cast<uint8_t>(AlarmCode::WaterTemperatureSensorFault) -
+              static_cast<uint8_t>(AlarmCode::AmbientHumiditySensorFault) ==
+              static_cast<uint8_t>(AmbientInput::WaterTemperature), "sensor fault codes follow AmbientInput");
 
 /**
  * <br/>
  * Business logic uses no measurement units.<br/>
- * Measurement units (°C or °F) depend on concrete <tt>Sensor</tt> implementation.
+ * Measurement units (°C or °F) depend on concrete <tt>Sensor</tt> implementation.<br/>
+ * Readings are fixed-point <tt>Centi</tt>, no soft-float in the rules.<br/>
+ * <br/>
+ * Actuators and alarms are driven by a table of <tt>AmbientRule</tt>, evaluated in one pass:
+ * <ul>
+ * <li>rules on the same actuator are OR-combined, the actuator is on while any of its rules demands it</li>
+ * <li>the actuator switches only after its minimum on/off time (greatest of its rules) elapsed, the threshold
+ * and dwell logic is <tt>HysteresisSwitch</tt>, shared with <tt>ThresholdController</tt></li>
+ * <li>disabled actuators are switched off and their alarms acknowledged</li>
+ * <li>rules on inputs never set, stale or failed do not demand, i.e. fail safe off, and clear their alarm</li>
+ * <li>an input that had a reading and turns stale or failed raises its <tt>*SensorFault</tt> alarm (Major)</li>
+ * </ul>
+ * The quality of an input is the one of the <tt>Sensor</tt> attached with <tt>attachSensor</tt>,
+ * a failed read (<tt>Sensor::setError()</tt>) reaches the rules at once through the sensor connection.
+ * Inputs without a sensor are valid from the first <tt>setInput</tt> until an error is forwarded.<br/>
+ * Evaluation is event driven: a rule is evaluated only when its input changed value or quality (dirty flag per input),
+ * when a sensor reading expires, or when a pending minimum on/off time elapsed (one cached deadline).<br/>
+ * Call <tt>invalidateRules()</tt> after editing a table in RAM.<br/>
+ * Functions added to <tt>rules</tt> are invoked on every loop after the table.
  */
 class AmbientStation :
         public AbstractRunnable,
@@ -27,10 +69,35 @@ class AmbientStation :
 
 private:
 
-    float ambientHumidity = -100.0f;
-    float ambientTemperature = -100.0f;
-    float systemTemperature = -100.0f;
-    float waterTemperature = -100.0f;
+    static constexpr uint8_t inputCount = 4;
+    static constexpr uint8_t actuatorCount = static_cast<uint8_t>(AmbientActuator::None);
+
+    Centi inputs[inputCount];
+    Sensor<Centi> const *sensors[inputCount];
+    uint8_t inputSetMask = 0;
+    uint8_t inputErrorMask = 0;     // <- error forwarded since the last reading
+    uint8_t inputInvalidMask = 0;   // <- invalid at the last evaluation, the next reading re-evaluates
+
+    AmbientRule const *ruleTable = nullptr;
+    uint8_t ruleCount = 0;
+    bool isRuleTableInProgmem = false;
+    uint32_t ruleDemandMask = 0;
+    uint32_t ruleDirtyMask = 0;
+    uint32_t inputRuleMask[inputCount];
+
+    Switchable *actuators[actuatorCount];
+    HysteresisSwitch actuatorSwitches[actuatorCount];
+    uint8_t actuatorMinOnSeconds[actuatorCount];
+    uint8_t actuatorMinOffSeconds[actuatorCount];
+    uint8_t actuatorControlledMask = 0;
+    uint8_t actuatorDemandMask = 0;
+    uint8_t actuatorEnabledMask = 0xFF;
+
+    uint32_t deadlineMs = 0;
+    bool hasDeadline = false;
+    uint16_t evaluationCount = 0;
+
+    AbstractAlarmStation *pAlarmStation = nullptr;
 
     State ambientStationState = State::Active;
 
@@ -38,6 +105,14 @@ public:
 
     FunctionList rules;
 
+    AmbientStation() :
+            inputs{Centi::fromWhole(-100), Centi::fromWhole(-100), Centi::fromWhole(-100), Centi::fromWhole(-100)},
+            sensors{},
+            inputRuleMask{},
+            actuators{},
+            actuatorMinOnSeconds{},
+            actuatorMinOffSeconds{} {}
+
     bool isInState(State const &compareState) const {
         return ambientStationState == compareState;
     }
@@ -46,38 +121,143 @@ public:
         return ambientStationState;
     }
 
+    /* § Section: Rule Table */
+
+    /**
+     * <br/>
+     * The table is not copied, it must outlive the station.
+     *
+     * @param ruleTable – rules in RAM, e.g. a global array or a copy loaded from EEPROM
+     * @param ruleCount – number of rules, at most <tt>AMBIENT_STATION_MAX_RULES</tt>
+     */
+    void setRules(AmbientRule const *ruleTable, uint8_t const ruleCount) {
+        AmbientStation::assignRules(ruleTable, ruleCount, false);
+    }
+
+    /**
+     * <br/>
+     * Same as <tt>setRules</tt> for a table declared <tt>PROGMEM</tt>, rows are fetched with <tt>memcpy_P</tt>.
+     */
+    void setRulesP(AmbientRule const *ruleTable, uint8_t const ruleCount) {
+        AmbientStation::assignRules(ruleTable, ruleCount, true);
+    }
+
+    uint8_t getRuleCount() const {
+        return ruleCount;
+    }
+
+    /**
+     * <br/>
+     * Re-reads the table and evaluates every rule on the next loop, call after editing the table.
+     */
+    void invalidateRules() {
+        AmbientStation::indexRules();
+        ruleDirtyMask = ruleCount == 32 ? UINT32_MAX : (1ul << ruleCount) - 1;
+    }
+
+    /**
+     * @return <tt>true</tt> if a rule waits for evaluation, i.e. the next loop does rule work
+     */
+    bool hasPendingRules() const {
+        return ruleDirtyMask != 0;
+    }
+
+    /**
+     * @return rule table passes so far, wraps around
+     */
+    uint16_t getEvaluationCount() const {
+        return evaluationCount;
+    }
+
+    void attachActuator(AmbientActuator const actuator, Switchable &switchable) {
+        actuators[static_cast<uint8_t>(actuator)] = &switchable;
+        AmbientStation::invalidateRules();
+    }
+
+    void attachAlarmStation(AbstractAlarmStation &alarmStation) {
+        pAlarmStation = &alarmStation;
+    }
+
+    void setActuatorEnabled(AmbientActuator const actuator, bool const isEnabled) {
+        uint8_t bit = static_cast<uint8_t>(1u << static_cast<uint8_t>(actuator));
+        actuatorEnabledMask = isEnabled ? actuatorEnabledMask | bit : actuatorEnabledMask & ~bit;
+        AmbientStation::invalidateRules();
+    }
+
+    bool isActuatorEnabled(AmbientActuator const actuator) const {
+        return (actuatorEnabledMask >> static_cast<uint8_t>(actuator)) & 1u;
+    }
+
+    /**
+     * <br/>
+     * The rules follow the quality of the sensor, e.g. a reading older than its <tt>maxAgeMs</tt> is stale.
+     */
+    void attachSensor(AmbientInput const input, Sensor<Centi> const &sensor) {
+        sensors[static_cast<uint8_t>(input)] = &sensor;
+        AmbientStation::invalidateRules();
+    }
+
+    /**
+     * <br/>
+     * Called by the sensor connections, a quality other than <tt>Ok</tt> invalidates the input until its next reading.
+     */
+    void setInputQuality(AmbientInput const input, ReadingQuality const quality) {
+        uint8_t index = static_cast<uint8_t>(input);
+        uint8_t bit = static_cast<uint8_t>(1u << index);
+        if (quality == ReadingQuality::Ok || (inputErrorMask & bit)) {
+            return;
+        }
+        inputErrorMask |= bit;
+        ruleDirtyMask |= inputRuleMask[index];
+    }
+
+    bool isInputValid(AmbientInput const input) const {
+        uint8_t index = static_cast<uint8_t>(input);
+        if ((inputErrorMask >> index) & 1u) {
+            return false;
+        }
+        if (sensors[index] != nullptr) {
+            return sensors[index]->isFresh();
+        }
+        return (inputSetMask >> index) & 1u;
+    }
+
     /* § Section: Setters, Sensor Readings */
-    void setAmbientHumidity(float const ambientHumidity) {
-        AmbientStation::ambientHumidity = ambientHumidity;
+    void setAmbientHumidity(Centi const ambientHumidity) {
+        AmbientStation::setInput(AmbientInput::AmbientHumidity, ambientHumidity);
     }
 
-    void setAmbientTemperature(float const ambientTemperature) {
-        AmbientStation::ambientTemperature = ambientTemperature;
+    void setAmbientTemperature(Centi const ambientTemperature) {
+        AmbientStation::setInput(AmbientInput::AmbientTemperature, ambientTemperature);
     }
 
-    void setSystemTemperature(float const systemTemperature) {
-        AmbientStation::systemTemperature = systemTemperature;
+    void setSystemTemperature(Centi const systemTemperature) {
+        AmbientStation::setInput(AmbientInput::SystemTemperature, systemTemperature);
     }
 
-    void setWaterTemperature(float const waterTemperature) {
-        AmbientStation::waterTemperature = waterTemperature;
+    void setWaterTemperature(Centi const waterTemperature) {
+        AmbientStation::setInput(AmbientInput::WaterTemperature, waterTemperature);
     }
 
     /* § Section: Getters, Sensor Readings */
-    float getAmbientHumidity() const {
-        return ambientHumidity;
+    Centi getInput(AmbientInput const input) const {
+        return inputs[static_cast<uint8_t>(input)];
+    }
+
+    Centi getAmbientHumidity() const {
+        return AmbientStation::getInput(AmbientInput::AmbientHumidity);
     }
 
-    float getAmbientTemperature() const {
-        return ambientTemperature;
+    Centi getAmbientTemperature() const {
+        return AmbientStation::getInput(AmbientInput::AmbientTemperature);
     }
 
-    float getSystemTemperature() const {
-        return systemTemperature;
+    Centi getSystemTemperature() const {
+        return AmbientStation::getInput(AmbientInput::SystemTemperature);
     }
 
-    float getWaterTemperature() const {
-        return waterTemperature;
+    Centi getWaterTemperature() const {
+        return AmbientStation::getInput(AmbientInput::WaterTemperature);
     }
 
     /* § Section: ISleepable Methods */
@@ -104,6 +284,7 @@ public:
                 AmbientStation::stopSleeping();
             }
         } else {
+            AmbientStation::evaluateRules();
             rules.invokeAll();
         }
     }
@@ -115,6 +296,239 @@ private:
     void setState(State const newStationState) {
         ambientStationState = newStationState;
     }
+
+    /* § Section: Rule Evaluation */
+
+    void assignRules(AmbientRule const *ruleTable, uint8_t const ruleCount, bool const isInProgmem) {
+        AmbientStation::ruleTable = ruleTable;
+        AmbientStation::ruleCount = ruleCount > AMBIENT_STATION_MAX_RULES ? AMBIENT_STATION_MAX_RULES : ruleCount;
+        AmbientStation::isRuleTableInProgmem = isInProgmem;
+        AmbientStation::ruleDemandMask = 0;
+        AmbientStation::invalidateRules();
+    }
+
+    /**
+     * <br/>
+     * One pass over the table caching input -> rules dependencies and the dwell of each actuator.
+     */
+    void indexRules() {
+        actuatorControlledMask = 0;
+        for (uint8_t index = 0; index < inputCount; ++index) {
+            inputRuleMask[index] = 0;
+        }
+        for (uint8_t index = 0; index < actuatorCount; ++index) {
+            actuatorMinOnSeconds[index] = 0;
+            actuatorMinOffSeconds[index] = 0;
+        }
+
+        for (uint8_t index = 0; index < ruleCount; ++index) {
+            AmbientRule rule;
+            AmbientStation::fetchRule(index, rule);
+
+            inputRuleMask[static_cast<uint8_t>(rule.input)] |= 1ul << index;
+
+            uint8_t actuatorIndex = static_cast<uint8_t>(rule.actuator);
+            if (actuatorIndex < actuatorCount) {
+                actuatorControlledMask |= static_cast<uint8_t>(1u << actuatorIndex);
+                if (rule.minOnSeconds > actuatorMinOnSeconds[actuatorIndex]) {
+                    actuatorMinOnSeconds[actuatorIndex] = rule.minOnSeconds;
+                }
+                if (rule.minOffSeconds > actuatorMinOffSeconds[actuatorIndex]) {
+                    actuatorMinOffSeconds[actuatorIndex] = rule.minOffSeconds;
+                }
+            }
+        }
+    }
+
+    void fetchRule(uint8_t const index, AmbientRule &rule) const {
+#ifdef __AVR__
+        if (isRuleTableInProgmem) {
+            memcpy_P(&rule, &ruleTable[index], sizeof(AmbientRule));
+            return;
+        }
+#endif
+        rule = ruleTable[index];
+    }
+
+    void setInput(AmbientInput const input, Centi const value) {
+        uint8_t index = static_cast<uint8_t>(input);
+        uint8_t bit = static_cast<uint8_t>(1u << index);
+
+        /* dirty only on change, or when the previous value was missing/invalid */
+        if (inputs[index] != value || !(inputSetMask & bit) || ((inputErrorMask | inputInvalidMask) & bit)) {
+            ruleDirtyMask |= inputRuleMask[index];
+        }
+
+        inputs[index] = value;
+        inputSetMask |= bit;
+        inputErrorMask &= static_cast<uint8_t>(~bit);
+    }
+
+    /**
+     * <br/>
+     * An input that had a reading, or reported an error, and is not valid now.
+     */
+    bool isInputFaulted(AmbientInput const input) const {
+        uint8_t index = static_cast<uint8_t>(input);
+        return ((inputSetMask | inputErrorMask) >> index) & 1u && !AmbientStation::isInputValid(input);
+    }
+
+    static AlarmCode sensorFaultCode(AmbientInput const input) {
+        return static_cast<AlarmCode>(static_cast<uint8_t>(AlarmCode::AmbientHumiditySensorFault) + static_cast<uint8_t>(input));
+    }
+
+    void raiseAlarm(AlarmCode const alarmCode, AlarmSeverity const alarmSeverity) {
+        if (pAlarmStation != nullptr) {
+            pAlarmStation->raiseAlarm(alarmCode, alarmSeverity);
+        }
+    }
+
+    void clearAlarm(AlarmCode const alarmCode) {
+        if (pAlarmStation != nullptr) {
+            pAlarmStation->clearAlarm(alarmCode);
+        }
+    }
+
+    void evaluateRules() {
+        uint32_t nowMs = millis();
+
+        if (hasDeadline && static_cast<int32_t>(nowMs - deadlineMs) >= 0) {
+            hasDeadline = false;
+            AmbientStation::markExpiredInputs();
+        } else if (ruleDirtyMask == 0) {
+            return;
+        }
+
+        ++evaluationCount;
+        for (uint8_t index = 0; index < ruleCount; ++index) {
+            uint32_t ruleBit = 1ul << index;
+            if (ruleDirtyMask & ruleBit) {
+                AmbientStation::evaluateRule(index);
+            }
+        }
+        ruleDirtyMask = 0;
+
+        AmbientStation::applyActuators(nowMs);
+        AmbientStation::scheduleInputExpiry();
+    }
+
+    void evaluateRule(uint8_t const index) {
+        AmbientRule rule;
+        AmbientStation::fetchRule(index, rule);
+
+        uint32_t ruleBit = 1ul << index;
+        bool hasActuator = static_cast<uint8_t>(rule.actuator) < actuatorCount;
+
+        if (hasActuator && !AmbientStation::isActuatorEnabled(rule.actuator)) {
+            ruleDemandMask &= ~ruleBit;
+            AmbientStation::clearAlarm(rule.alarmCode);
+            return;
+        }
+
+        uint8_t inputBit = static_cast<uint8_t>(1u << static_cast<uint8_t>(rule.input));
+        if (!AmbientStation::isInputValid(rule.input)) {
+            ruleDemandMask &= ~ruleBit;
+            inputInvalidMask |= inputBit;
+            AmbientStation::clearAlarm(rule.alarmCode);
+            if (AmbientStation::isInputFaulted(rule.input)) {
+                AmbientStation::raiseAlarm(AmbientStation::sensorFaultCode(rule.input), AlarmSeverity::Major);
+            }
+            return;
+        }
+        inputInvalidMask &= static_cast<uint8_t>(~inputBit);
+        AmbientStation::clearAlarm(AmbientStation::sensorFaultCode(rule.input));
+
+        Centi value = inputs[static_cast<uint8_t>(rule.input)];
+
+        if (rule.isDemanding(value, (ruleDemandMask & ruleBit) != 0)) {
+            ruleDemandMask |= ruleBit;
+        } else {
+            ruleDemandMask &= ~ruleBit;
+        }
+
+        if (rule.isAlarming(value)) {
+            AmbientStation::raiseAlarm(rule.alarmCode, rule.alarmSeverity);
+        } else {
+            AmbientStation::clearAlarm(rule.alarmCode);
+        }
+    }
+
+    /**
+     * <br/>
+     * OR-combines the rule demands per actuator, a switch blocked by the dwell time becomes the deadline.
+     */
+    void applyActuators(uint32_t const nowMs) {
+        actuatorDemandMask = 0;
+        for (uint8_t index = 0; index < ruleCount; ++index) {
+            if ((ruleDemandMask >> index) & 1ul) {
+                AmbientRule rule;
+                AmbientStation::fetchRule(index, rule);
+                if (static_cast<uint8_t>(rule.actuator) < actuatorCount) {
+                    actuatorDemandMask |= static_cast<uint8_t>(1u << static_cast<uint8_t>(rule.actuator));
+                }
+            }
+        }
+
+        for (uint8_t actuatorIndex = 0; actuatorIndex < actuatorCount; ++actuatorIndex) {
+            Switchable *pSwitchable = actuators[actuatorIndex];
+            if (pSwitchable == nullptr || !((actuatorControlledMask >> actuatorIndex) & 1u)) {
+                continue;
+            }
+
+            Switched newState = (actuatorDemandMask >> actuatorIndex) & 1u ? Switched::On : Switched::Off;
+            if (pSwitchable->isInState(newState)) {
+                continue;
+            }
+
+            /* dwell, a disabled actuator is switched off right away */
+            if ((actuatorEnabledMask >> actuatorIndex) & 1u) {
+                uint32_t waitMs = actuatorSwitches[actuatorIndex].getWaitMs(
+                        newState,
+                        1000ul * actuatorMinOnSeconds[actuatorIndex],
+                        1000ul * actuatorMinOffSeconds[actuatorIndex],
+                        nowMs);
+                if (waitMs > 0) {
+                    AmbientStation::scheduleDeadline(nowMs + waitMs);
+                    continue;
+                }
+            }
+
+            pSwitchable->setState(newState);
+            actuatorSwitches[actuatorIndex].markSwitched(nowMs);
+        }
+    }
+
+    /**
+     * <br/>
+     * Marks the rules of inputs turned invalid since the last evaluation, inputs already invalid stay quiet.
+     */
+    void markExpiredInputs() {
+        for (uint8_t index = 0; index < inputCount; ++index) {
+            if (!((inputInvalidMask >> index) & 1u) && !AmbientStation::isInputValid(static_cast<AmbientInput>(index))) {
+                ruleDirtyMask |= inputRuleMask[index];
+            }
+        }
+    }
+
+    /**
+     * <br/>
+     * Schedules the expiry of sensor readings still fresh, an expired one waits for the next reading.
+     */
+    void scheduleInputExpiry() {
+        for (uint8_t index = 0; index < inputCount; ++index) {
+            Sensor<Centi> const *pSensor = sensors[index];
+            if (pSensor != nullptr && inputRuleMask[index] != 0 && pSensor->getMaxAgeMs() > 0 && pSensor->isFresh()) {
+                AmbientStation::scheduleDeadline(pSensor->getReadingMs() + pSensor->getMaxAgeMs() + 1);
+            }
+        }
+    }
+
+    void scheduleDeadline(uint32_t const atMs) {
+        if (!hasDeadline || static_cast<int32_t>(atMs - deadlineMs) < 0) {
+            deadlineMs = atMs;
+            hasDeadline = true;
+        }
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
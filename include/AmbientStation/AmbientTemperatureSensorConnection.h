@@ -3,6 +3,7 @@
 #pragma once
 
 #include <Abstract/AbstractConnection.h>
+#include <Enums/AmbientInput.h>
 
 /**
  * <br/>
@@ -10,6 +11,7 @@
  * <strong>Note:</strong> Consumer method must exist!<br/>
  * \code
  * ((S) consumer).setAmbientHumidity((T) data)
+ * ((S) consumer).setInputQuality(AmbientInput::AmbientHumidity, (ReadingQuality) quality)
  * \endcode
  *
  * @tparam S – consumer type
@@ -25,6 +27,10 @@ public:
     void forward(T const &data) const override {
         AbstractConnection<S, T>::consumer.setAmbientHumidity(data);
     }
+
+    void forwardQuality(ReadingQuality const quality) const override {
+        AbstractConnection<S, T>::consumer.setInputQuality(AmbientInput::AmbientHumidity, quality);
+    }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,205 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_AMBIENT_STATION_PID_HEATER_CONTROLLER_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_AMBIENT_STATION_PID_HEATER_CONTROLLER_H_
+#pragma once
+
+#ifdef __TEST_MODE__
+
+#include <stdint.h>
+#include "../../test/_Mocks/MockCommon.h"
+
+#endif
+
+#include <Common/PidController.h>
+#include <Common/RelayAutotuner.h>
+#include <Common/SensorReading.h>
+#include <Enums/Switched.h>
+#include <Abstract/AbstractRunnable.h>
+
+/**
+ * <br/>
+ * Concrete class, PID heater with time-proportional relay output, no heap.<br/>
+ * Once per window the PID turns the reading into a duty (per mille), the relay is on for
+ * <tt>duty × windowMs</tt> at the start of the window and off for the rest of it.
+ * Pulses shorter than <tt>minPulseMs</tt> are dropped (or the window is kept on), so a settled loop
+ * at low or high duty does not toggle the relay every window.<br/>
+ * The relay switches at most twice per window, the 10 min default is 288 switches a day at most,
+ * shorten it only for solid state relays.<br/>
+ * A stale sensor (<tt>isFresh() == false</tt>) switches the heater off and resets the PID.<br/>
+ * <tt>startAutotune</tt> runs <tt>RelayAutotuner</tt> around the set point and loads the resulting gains,
+ * gains out of range for the window fail the tune and the previous ones are kept.
+ * \code
+ *     PidHeaterController<Sensor<Centi>, ArduinoSwitchable> heater{
+ *             waterTemperatureSensor, heaterRelay, Centi::fromFloat(24.5f), PidGains{8148, 4310, 3850}};
+ * \endcode
+ *
+ * @tparam S – sensor type, provides <tt>getReading()</tt> (<tt>Centi</tt>) and <tt>isFresh()</tt>
+ * @tparam W – switchable type, provides <tt>isInState(Switched)</tt> and <tt>setState(Switched)</tt>
+ */
+template<typename S, typename W>
+class PidHeaterController :
+        public AbstractRunnable {
+
+public:
+
+    using T = typename SensorReading<S>::type;
+
+    static constexpr uint16_t outputMax = 1000; // <- per mille duty
+
+private:
+
+    S const &sensor;
+    W &switchable;
+    T setPoint;
+    PidController pidController;
+    RelayAutotuner autotuner;
+    uint32_t windowMs;
+    uint32_t minPulseMs;
+    uint32_t windowStartMs = 0;
+    uint32_t windowOnMs = 0;
+    uint16_t duty = 0;
+    bool hasWindow = false;
+    bool isAutotuning = false;
+    bool hasAutotuneFailed = false;
+    uint16_t switchCount = 0;
+
+public:
+
+    /**
+     * @param sensor – sensor polled by the controller
+     * @param switchable – heater relay
+     * @param setPoint – wanted temperature
+     * @param gains – Q8 gains per window, see <tt>PidGains</tt>
+     * @param windowMs – time-proportional window, also the PID sample period
+     * @param minPulseMs – shortest on or off pulse inside a window
+     */
+    PidHeaterController(
+            S const &sensor,
+            W &switchable,
+            T const setPoint,
+            PidGains const gains,
+            uint32_t const windowMs = 10ul * 60ul * 1000ul,
+            uint32_t const minPulseMs = 30ul * 1000ul
+    ) :
+            sensor(sensor),
+            switchable(switchable),
+            setPoint(setPoint),
+            pidController(gains, outputMax),
+            autotuner(setPoint.getRaw(), 0, outputMax),
+            windowMs(windowMs),
+            minPulseMs(minPulseMs) {}
+
+    T getSetPoint() const {
+        return setPoint;
+    }
+
+    void setSetPoint(T const setPoint) {
+        PidHeaterController::setPoint = setPoint;
+    }
+
+    PidGains const &getGains() const {
+        return pidController.getGains();
+    }
+
+    void setGains(PidGains const gains) {
+        pidController.setGains(gains);
+    }
+
+    /**
+     * <br/>
+     * Duty of the current window, per mille.
+     */
+    uint16_t getDuty() const {
+        return duty;
+    }
+
+    /**
+     * <br/>
+     * Relay switch events since start, wraps.
+     */
+    uint16_t getSwitchCount() const {
+        return switchCount;
+    }
+
+    /**
+     * <br/>
+     * Drives the relay bang-bang around the set point until the limit cycle is measured, then loads the gains.
+     *
+     * @param hysteresis – relay switches at <tt>setPoint ± hysteresis</tt>, above the sensor noise
+     */
+    void startAutotune(T const hysteresis) {
+        autotuner = RelayAutotuner{setPoint.getRaw(), hysteresis.getRaw(), outputMax};
+        isAutotuning = true;
+        hasAutotuneFailed = false;
+    }
+
+    bool isInAutotune() const {
+        return isAutotuning;
+    }
+
+    /**
+     * <br/>
+     * The last autotune gave gains out of range for the window, the previous gains are kept.
+     */
+    bool isAutotuneFailed() const {
+        return hasAutotuneFailed;
+    }
+
+    void setup() override {}
+
+    void loop() override {
+        uint32_t nowMs = millis();
+
+        if (!sensor.isFresh()) {
+            pidController.reset();
+            duty = 0;
+            hasWindow = false;
+            PidHeaterController::switchTo(Switched::Off);
+            return;
+        }
+
+        if (isAutotuning) {
+            bool isOn = autotuner.update(sensor.getReading().getRaw(), nowMs);
+            if (autotuner.isDone()) {
+                PidGains gains = pidController.getGains();
+                hasAutotuneFailed = !autotuner.getGains(windowMs, gains);
+                pidController.setGains(gains);
+                pidController.reset();
+                isAutotuning = false;
+                hasWindow = false;
+            }
+            duty = isOn ? outputMax : 0;
+            PidHeaterController::switchTo(isOn ? Switched::On : Switched::Off);
+            return;
+        }
+
+        if (!hasWindow || nowMs - windowStartMs >= windowMs) {
+            PidHeaterController::startWindow(nowMs);
+        }
+
+        PidHeaterController::switchTo(nowMs - windowStartMs < windowOnMs ? Switched::On : Switched::Off);
+    }
+
+private:
+
+    void startWindow(uint32_t const nowMs) {
+        windowStartMs = nowMs;
+        hasWindow = true;
+        duty = pidController.compute(setPoint.getRaw(), sensor.getReading().getRaw());
+
+        windowOnMs = windowMs * duty / outputMax;
+        if (windowOnMs < minPulseMs) {
+            windowOnMs = 0;
+        } else if (windowMs - windowOnMs < minPulseMs) {
+            windowOnMs = windowMs;
+        }
+    }
+
+    void switchTo(Switched const newState) {
+        if (!switchable.isInState(newState)) {
+            switchable.setState(newState);
+            ++switchCount;
+        }
+    }
+};
+
+#endif
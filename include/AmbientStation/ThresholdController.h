@@ -0,0 +1,177 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_AMBIENT_STATION_THRESHOLD_CONTROLLER_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_AMBIENT_STATION_THRESHOLD_CONTROLLER_H_
+#pragma once
+
+#ifdef __TEST_MODE__
+
+#include <stdint.h>
+#include "../../test/_Mocks/MockCommon.h"
+
+#endif
+
+#include <Enums/AlarmCode.h>
+#include <Enums/AlarmSeverity.h>
+#include <Common/HysteresisSwitch.h>
+#include <Common/SensorReading.h>
+#include <Enums/Switched.h>
+#include <Abstract/AbstractRunnable.h>
+#include <AlarmStation/AbstractAlarmStation.h>
+
+/**
+ * <br/>
+ * Concrete class, hysteresis thermostat for one sensor and one actuator, no heap.<br/>
+ * The direction follows from the thresholds:
+ * <ul>
+ * <li><tt>onThreshold < offThreshold</tt> – heating, on at <tt>reading < onThreshold</tt>, off at <tt>reading ≥ offThreshold</tt></li>
+ * <li><tt>onThreshold ≥ offThreshold</tt> – cooling, on at <tt>reading ≥ onThreshold</tt>, off at <tt>reading < offThreshold</tt></li>
+ * </ul>
+ * The switchable changes state only after it stayed on for <tt>minOnMs</tt> or off for <tt>minOffMs</tt>,
+ * the first switch is immediate, see <tt>HysteresisSwitch</tt>. A stale sensor (<tt>isFresh() == false</tt>) does not demand, i.e. fail safe off.<br/>
+ * With <tt>setAlarmBand</tt> the alarm is raised once when the reading leaves <tt>[alarmLow, alarmHigh]</tt>
+ * and acknowledged once when it returns.
+ * \code
+ *     ThresholdController<Sensor<Centi>, Switchable> heater{
+ *             waterTemperatureSensor, heaterRelay, Centi::fromFloat(24.4f), Centi::fromFloat(24.6f), 30000, 30000};
+ * \endcode
+ *
+ * @tparam S – sensor type, provides <tt>getReading()</tt> and <tt>isFresh()</tt>, e.g. <tt>Sensor<Centi></tt>
+ * @tparam W – switchable type, provides <tt>isInState(Switched)</tt> and <tt>setState(Switched)</tt>
+ */
+template<typename S, typename W>
+class ThresholdController :
+        public AbstractRunnable {
+
+public:
+
+    using T = typename SensorReading<S>::type;
+
+private:
+
+    S const &sensor;
+    W &switchable;
+    T onThreshold;
+    T offThreshold;
+    uint32_t minOnMs;
+    uint32_t minOffMs;
+    HysteresisSwitch hysteresisSwitch;
+    bool isDemanding = false;
+
+    AbstractAlarmStation *pAlarmStation = nullptr;
+    AlarmCode alarmCode = AlarmCode::NoAlarm;
+    AlarmSeverity alarmSeverity = AlarmSeverity::Minor;
+    T alarmLow;
+    T alarmHigh;
+    bool isAlarmRaised = false;
+
+public:
+
+    /**
+     * @param sensor – sensor polled every loop
+     * @param switchable – actuator driven by the controller
+     * @param onThreshold – reading where the actuator is switched on
+     * @param offThreshold – reading where the actuator is switched off, the distance to <tt>onThreshold</tt> is the hysteresis
+     * @param minOnMs – minimum time the actuator stays on
+     * @param minOffMs – minimum time the actuator stays off
+     */
+    ThresholdController(
+            S const &sensor,
+            W &switchable,
+            T const onThreshold,
+            T const offThreshold,
+            uint32_t const minOnMs = 0,
+            uint32_t const minOffMs = 0
+    ) :
+            sensor(sensor),
+            switchable(switchable),
+            onThreshold(onThreshold),
+            offThreshold(offThreshold),
+            minOnMs(minOnMs),
+            minOffMs(minOffMs),
+            alarmLow(),
+            alarmHigh() {}
+
+    void setThresholds(T const onThreshold, T const offThreshold) {
+        ThresholdController::onThreshold = onThreshold;
+        ThresholdController::offThreshold = offThreshold;
+    }
+
+    T getOnThreshold() const {
+        return onThreshold;
+    }
+
+    T getOffThreshold() const {
+        return offThreshold;
+    }
+
+    bool isHeating() const {
+        return onThreshold < offThreshold;
+    }
+
+    /**
+     * @param alarmStation – station receiving the alarm
+     * @param alarmCode – code raised while the reading is outside the band
+     * @param alarmSeverity – severity of the raised alarm
+     * @param alarmLow – lowest reading without alarm
+     * @param alarmHigh – highest reading without alarm
+     */
+    void setAlarmBand(
+            AbstractAlarmStation &alarmStation,
+            AlarmCode const alarmCode,
+            AlarmSeverity const alarmSeverity,
+            T const alarmLow,
+            T const alarmHigh
+    ) {
+        ThresholdController::pAlarmStation = &alarmStation;
+        ThresholdController::alarmCode = alarmCode;
+        ThresholdController::alarmSeverity = alarmSeverity;
+        ThresholdController::alarmLow = alarmLow;
+        ThresholdController::alarmHigh = alarmHigh;
+    }
+
+    bool isAlarming() const {
+        return isAlarmRaised;
+    }
+
+    void setup() override {}
+
+    void loop() override {
+        uint32_t nowMs = millis();
+
+        if (sensor.isFresh()) {
+            T reading = sensor.getReading();
+            isDemanding = HysteresisSwitch::isDemanding(
+                    reading, onThreshold, offThreshold, !ThresholdController::isHeating(), isDemanding);
+            ThresholdController::updateAlarm(reading < alarmLow || alarmHigh < reading);
+        } else {
+            isDemanding = false;
+        }
+
+        Switched newState = isDemanding ? Switched::On : Switched::Off;
+        if (switchable.isInState(newState)) {
+            return;
+        }
+
+        if (hysteresisSwitch.getWaitMs(newState, minOnMs, minOffMs, nowMs) > 0) {
+            return;
+        }
+
+        switchable.setState(newState);
+        hysteresisSwitch.markSwitched(nowMs);
+    }
+
+private:
+
+    void updateAlarm(bool const isOutsideBand) {
+        if (pAlarmStation == nullptr || isOutsideBand == isAlarmRaised) {
+            return;
+        }
+        isAlarmRaised = isOutsideBand;
+        if (isOutsideBand) {
+            pAlarmStation->raiseAlarm(alarmCode, alarmSeverity);
+        } else {
+            pAlarmStation->clearAlarm(alarmCode);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ATO_STATION_ABSTRACT_ATO_LEVEL_BANK_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ATO_STATION_ABSTRACT_ATO_LEVEL_BANK_H_
+#pragma once
+
+#include <stdint.h>
+
+#include <Enums/AtoLevelChannel.h>
+#include <Enums/Level.h>
+#include <Abstract/AbstractRunnable.h>
+
+#include "AtoStation.h"
+
+#ifndef ATO_LEVEL_BANK_ROUTES
+#define ATO_LEVEL_BANK_ROUTES 16
+#endif
+
+/**
+ * <br/>
+ * All level sensors of all ATO stations in one scan, no heap.<br/>
+ * <tt>readInputs()</tt> returns every sensor as one bit (e.g. one port register read), each route forwards a bit
+ * to a level channel of a station. A bit may feed several stations, e.g. a shared reservoir sensor.<br/>
+ * Routes are walked only for bits that changed since the previous scan, a steady scan is one read and one compare,
+ * so adding a station adds no I/O.<br/>
+ * To do, implement / override:
+ * <ul>
+ * <li><tt>void AbstractRunnable::setup()</tt></li>
+ * <li><tt>uint32_t AbstractAtoLevelBank::readInputs()</tt>, bit set when the sensor output is high</li>
+ * </ul>
+ */
+class AbstractAtoLevelBank :
+        public AbstractRunnable {
+
+public:
+
+    static constexpr uint8_t capacity = ATO_LEVEL_BANK_ROUTES;
+
+private:
+
+    struct Route {
+        AtoStation *pAtoStation;
+        uint32_t mask;
+        AtoLevelChannel channel;
+    };
+
+    Route routes[capacity];
+    uint8_t routeCount = 0;
+
+    uint32_t routedMask = 0;
+    uint32_t invertedMask = 0;
+    uint32_t lastInputs = 0;
+    bool hasScanned = false;
+
+public:
+
+    AbstractAtoLevelBank() : routes{} {}
+
+    virtual ~AbstractAtoLevelBank() = default;
+
+    /**
+     * @param bit – position of the sensor in <tt>readInputs()</tt>, 0 .. 31
+     * @param atoStation – station receiving the level
+     * @param channel – sensor role in that station
+     * @param notInvertedInput – <tt>true</tt> if a high output means water is sensed, applies to the bit
+     * @return <tt>false</tt> if all routes are taken or the bit is out of range
+     */
+    bool connect(uint8_t const bit, AtoStation &atoStation, AtoLevelChannel const channel, bool const notInvertedInput = true) {
+        if (routeCount >= capacity || bit >= 32) {
+            return false;
+        }
+        uint32_t mask = 1ul << bit;
+        routes[routeCount++] = Route{&atoStation, mask, channel};
+        routedMask |= mask;
+        invertedMask = notInvertedInput ? invertedMask & ~mask : invertedMask | mask;
+        hasScanned = false;
+        return true;
+    }
+
+    uint8_t getRouteCount() const {
+        return routeCount;
+    }
+
+    void loop() override {
+        uint32_t inputs = (readInputs() ^ invertedMask) & routedMask;
+        uint32_t changed = hasScanned ? inputs ^ lastInputs : routedMask;
+        if (changed == 0) {
+            return;
+        }
+
+        lastInputs = inputs;
+        hasScanned = true;
+
+        for (uint8_t index = 0; index < routeCount; ++index) {
+            Route const &route = routes[index];
+            if (changed & route.mask) {
+                AbstractAtoLevelBank::forward(route, (inputs & route.mask) ? Level::High : Level::Low);
+            }
+        }
+    }
+
+protected:
+
+    virtual uint32_t readInputs() = 0;
+
+private:
+
+    static void forward(Route const &route, Level const level) {
+        switch (route.channel) {
+            case AtoLevelChannel::Normal:
+                route.pAtoStation->setNormalLevelState(level);
+                break;
+            case AtoLevelChannel::High:
+                route.pAtoStation->setHighLevelState(level);
+                break;
+            case AtoLevelChannel::Low:
+                route.pAtoStation->setLowLevelState(level);
+                break;
+            case AtoLevelChannel::Reservoir:
+                route.pAtoStation->setReservoirLevelState(level);
+                break;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ATO_STATION_ATO_ALARM_CODES_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ATO_STATION_ATO_ALARM_CODES_H_
+#pragma once
+
+#include <stdint.h>
+
+#include <Enums/AlarmCode.h>
+
+/**
+ * <br/>
+ * Alarm codes raised by one <tt>AtoStation</tt>, the defaults are the codes of the first station.<br/>
+ * Stations sharing a reservoir share <tt>reservoirLow</tt>, so an empty reservoir is one alarm,
+ * raised by the first station sensing it and acknowledged by the first station sensing it refilled.
+ * \code
+ *     AtoStation sumpAtoStation{sumpSettings, sumpDispenser, AtoAlarmCodes::forStation<0>()};
+ *     AtoStation fragAtoStation{fragSettings, fragDispenser, AtoAlarmCodes::forStation<1>()};
+ * \endcode
+ */
+struct AtoAlarmCodes {
+
+    static constexpr uint8_t stationCount = 4;
+    static constexpr uint8_t codesPerStation = 3; // <- top-off failed, high level, low level
+
+    AlarmCode topOffFailed = AlarmCode::AtoTopOffFailed;
+    AlarmCode reservoirLow = AlarmCode::AtoReservoirLow;
+    AlarmCode highLevel = AlarmCode::AtoHighLevel;
+    AlarmCode lowLevel = AlarmCode::AtoLowLevel;
+
+    /**
+     * <br/>
+     * Codes of station <tt>stationIndex</tt>, a station past <tt>stationCount</tt> does not compile,
+     * it would run without level alarms.
+     *
+     * @tparam stationIndex – <tt>0 .. stationCount - 1</tt>
+     */
+    template<uint8_t stationIndex>
+    static AtoAlarmCodes forStation() {
+        static_assert(stationIndex < stationCount, "AlarmCode has level alarms for 4 ATO stations only");
+        AtoAlarmCodes alarmCodes{};
+        if (stationIndex == 0) {
+            return alarmCodes;
+        }
+        uint8_t first = static_cast<uint8_t>(
+                static_cast<uint8_t>(AlarmCode::Ato2TopOffFailed) + (stationIndex - 1) * codesPerStation);
+        alarmCodes.topOffFailed = static_cast<AlarmCode>(first);
+        alarmCodes.highLevel = static_cast<AlarmCode>(first + 1);
+        alarmCodes.lowLevel = static_cast<AlarmCode>(first + 2);
+        return alarmCodes;
+    }
+};
+
+#endif
@@ -0,0 +1,146 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ATO_STATION_ATO_DISPENSE_HISTORY_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ATO_STATION_ATO_DISPENSE_HISTORY_H_
+#pragma once
+
+#include <stdint.h>
+
+#ifndef ATO_DISPENSE_HISTORY_SIZE
+#define ATO_DISPENSE_HISTORY_SIZE 8
+#endif
+
+/**
+ * <br/>
+ * Concrete class, ring of the last completed top-offs, 4 bytes each, no heap.<br/>
+ * A sample is the pump run time (0.1 s resolution, up to 109 min) and the time since the previous
+ * completed top-off started (1 min resolution, up to 45 days).<br/>
+ * The ratio of both sums is the evaporation rate in pump time, e.g. 5 s of pumping every 20 min.
+ */
+class AtoDispenseHistory {
+
+public:
+
+    static constexpr uint8_t capacity = ATO_DISPENSE_HISTORY_SIZE;
+
+private:
+
+    struct Sample {
+        uint16_t durationDs;
+        uint16_t intervalMinutes;
+    };
+
+    Sample samples[capacity];
+    uint8_t head = 0;
+    uint8_t count = 0;
+
+    static uint16_t saturate(uint32_t const value) {
+        return static_cast<uint16_t>(value > UINT16_MAX ? UINT16_MAX : value);
+    }
+
+public:
+
+    AtoDispenseHistory() : samples{} {}
+
+    /**
+     * <br/>
+     * Stores a sample, the oldest one is dropped when full. Samples shorter than a minute of interval are ignored.
+     */
+    void record(uint32_t const durationMs, uint32_t const intervalMs) {
+        uint16_t intervalMinutes = AtoDispenseHistory::saturate(intervalMs / 60000ul);
+        if (intervalMinutes == 0) {
+            return;
+        }
+        samples[head] = Sample{AtoDispenseHistory::saturate((durationMs + 50) / 100), intervalMinutes};
+        head = static_cast<uint8_t>((head + 1) % capacity);
+        if (count < capacity) {
+            ++count;
+        }
+    }
+
+    void clear() {
+        head = 0;
+        count = 0;
+    }
+
+    uint8_t size() const {
+        return count;
+    }
+
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    uint32_t getTotalDurationMs() const {
+        uint32_t sumDs = 0;
+        for (uint8_t index = 0; index < count; ++index) {
+            sumDs += samples[index].durationDs;
+        }
+        return sumDs * 100ul;
+    }
+
+    uint32_t getTotalIntervalMinutes() const {
+        uint32_t sumMinutes = 0;
+        for (uint8_t index = 0; index < count; ++index) {
+            sumMinutes += samples[index].intervalMinutes;
+        }
+        return sumMinutes;
+    }
+
+    uint32_t getLongestDurationMs() const {
+        uint16_t longestDs = 0;
+        for (uint8_t index = 0; index < count; ++index) {
+            if (samples[index].durationDs > longestDs) {
+                longestDs = samples[index].durationDs;
+            }
+        }
+        return longestDs * 100ul;
+    }
+
+    /**
+     * <br/>
+     * Evaporation as pump run time per hour, <tt>0</tt> while empty.
+     */
+    uint32_t getPumpMsPerHour() const {
+        uint32_t totalMinutes = AtoDispenseHistory::getTotalIntervalMinutes();
+        if (totalMinutes == 0) {
+            return 0;
+        }
+        return AtoDispenseHistory::getTotalDurationMs() / totalMinutes * 60ul;
+    }
+
+    /**
+     * @param pumpFlowMlPerMinute – measured flow of the dispenser
+     * @return evaporated volume per day
+     */
+    uint32_t getEvaporationMlPerDay(uint16_t const pumpFlowMlPerMinute) const {
+        return AtoDispenseHistory::getPumpMsPerHour() * 24ul / 1000ul * pumpFlowMlPerMinute / 60ul;
+    }
+
+    /**
+     * @param durationMs – wanted pump run time, at most 13 min
+     * @return interval in which the learned evaporation needs <tt>durationMs</tt> of pumping, <tt>0</tt> while empty
+     */
+    uint32_t getIntervalForDurationMs(uint32_t const durationMs) const {
+        uint32_t totalDs = AtoDispenseHistory::getTotalDurationMs() / 100ul;
+        if (totalDs == 0) {
+            return 0;
+        }
+        /* 13 bits of duration × 19 bits of history minutes fit 32 bits */
+        uint32_t durationDs = durationMs / 100ul > 8191ul ? 8191ul : durationMs / 100ul;
+        uint32_t minutes = durationDs * AtoDispenseHistory::getTotalIntervalMinutes() / totalDs;
+        return (minutes > 71582ul ? 71582ul : minutes) * 60000ul; // <- 49 days, uint32_t ms limit
+    }
+
+    /**
+     * @param intervalMs – time since the last top-off
+     * @return pump run time the learned evaporation needs after <tt>intervalMs</tt>
+     */
+    uint32_t getDurationForIntervalMs(uint32_t const intervalMs) const {
+        uint32_t totalMinutes = AtoDispenseHistory::getTotalIntervalMinutes();
+        if (totalMinutes == 0) {
+            return 0;
+        }
+        return AtoDispenseHistory::getTotalDurationMs() / totalMinutes * (intervalMs / 60000ul);
+    }
+};
+
+#endif
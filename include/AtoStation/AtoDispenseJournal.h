@@ -0,0 +1,195 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ATO_STATION_ATO_DISPENSE_JOURNAL_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ATO_STATION_ATO_DISPENSE_JOURNAL_H_
+#pragma once
+
+#include <stdint.h>
+
+#include <Enums/AtoDispenseEnd.h>
+#include <Enums/Level.h>
+
+#ifndef ATO_DISPENSE_JOURNAL_BYTES
+#define ATO_DISPENSE_JOURNAL_BYTES 96
+#endif
+
+static_assert(ATO_DISPENSE_JOURNAL_BYTES <= UINT8_MAX, "ATO_DISPENSE_JOURNAL_BYTES must fit uint8_t offsets");
+
+/**
+ * <br/>
+ * One decoded journal record.
+ */
+struct AtoDispenseJournalEntry {
+    uint32_t startS;        // <- seconds since boot, wraps with millis()
+    uint32_t durationDs;    // <- pump run time, 0.1 s resolution
+    AtoDispenseEnd reason;
+    Level reservoirLevel;
+};
+
+/**
+ * <br/>
+ * Concrete class, byte ring of every dispense event, no heap.<br/>
+ * A record is one header byte (end reason and reservoir level) followed by two varints:
+ * seconds since the previous record started and the pump run time in 0.1 s.
+ * A usual top-off (every 20 min, 30 s) takes 5 bytes, the longest record takes <tt>maxRecordBytes</tt>.<br/>
+ * Recording encodes into a local buffer and drops whole oldest records until it fits,
+ * i.e. constant work bounded by <tt>maxRecordBytes</tt>, independent of the journal size.<br/>
+ * Only the oldest absolute start time is kept, the start delta of the oldest record is not read.
+ * \code
+ *     atoStation.getDispenseJournal().forEach([](AtoDispenseJournalEntry const &entry) {
+ *         Serial << entry.startS << "s " << entry.durationDs << "ds\n";
+ *     });
+ * \endcode
+ */
+class AtoDispenseJournal {
+
+public:
+
+    static constexpr uint8_t capacity = ATO_DISPENSE_JOURNAL_BYTES;
+    static constexpr uint8_t maxRecordBytes = 11; // <- header + 2 × 5 byte varint
+
+    static_assert(capacity >= 2 * maxRecordBytes, "ATO_DISPENSE_JOURNAL_BYTES must hold at least two records");
+
+private:
+
+    uint8_t bytes[capacity];
+    uint8_t head = 0;   // <- offset of the oldest record
+    uint8_t used = 0;
+    uint8_t count = 0;
+
+    uint32_t oldestStartS = 0;
+    uint32_t newestStartS = 0;
+    uint32_t newestStartMs = 0; // <- whole seconds after the first record, no drift from truncated deltas
+
+public:
+
+    AtoDispenseJournal() : bytes{} {}
+
+    /**
+     * @param startMs – millis() when the dispenser was switched on
+     * @param durationMs – pump run time
+     * @param reason – what stopped the dispenser
+     * @param reservoirLevel – reservoir sensor when the dispenser was switched off
+     */
+    void record(uint32_t const startMs, uint32_t const durationMs, AtoDispenseEnd const reason, Level const reservoirLevel) {
+        uint32_t deltaS = 0;
+        if (count == 0) {
+            newestStartS = startMs / 1000ul;
+            newestStartMs = newestStartS * 1000ul;
+        } else {
+            deltaS = (startMs - newestStartMs) / 1000ul;
+            newestStartMs += deltaS * 1000ul;
+            newestStartS += deltaS;
+        }
+
+        uint8_t encoded[maxRecordBytes];
+        uint8_t length = 0;
+        encoded[length++] = static_cast<uint8_t>(static_cast<uint8_t>(reason) | (static_cast<uint8_t>(reservoirLevel) << 3u));
+        length = AtoDispenseJournal::writeVarint(encoded, length, deltaS);
+        length = AtoDispenseJournal::writeVarint(encoded, length, (durationMs + 50ul) / 100ul);
+
+        while (capacity - used < length) {
+            AtoDispenseJournal::dropOldest();
+        }
+        if (count == 0) {
+            oldestStartS = newestStartS;
+        }
+
+        for (uint8_t index = 0; index < length; ++index) {
+            bytes[(head + used + index) % capacity] = encoded[index];
+        }
+        used = static_cast<uint8_t>(used + length);
+        ++count;
+    }
+
+    void clear() {
+        head = 0;
+        used = 0;
+        count = 0;
+    }
+
+    uint8_t size() const {
+        return count;
+    }
+
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    /**
+     * <br/>
+     * Encoded size of all records.
+     */
+    uint8_t getByteCount() const {
+        return used;
+    }
+
+    /**
+     * <br/>
+     * Decodes the records oldest first.
+     *
+     * @tparam F – callable taking <tt>AtoDispenseJournalEntry const &</tt>
+     */
+    template<typename F>
+    void forEach(F action) const {
+        uint8_t position = head;
+        uint32_t startS = oldestStartS;
+        for (uint8_t index = 0; index < count; ++index) {
+            uint8_t header = bytes[position];
+            position = AtoDispenseJournal::next(position);
+            uint32_t deltaS = AtoDispenseJournal::readVarint(position);
+            if (index > 0) {
+                startS += deltaS;
+            }
+            uint32_t durationDs = AtoDispenseJournal::readVarint(position);
+            action(AtoDispenseJournalEntry{
+                    startS,
+                    durationDs,
+                    static_cast<AtoDispenseEnd>(header & 0x07u),
+                    static_cast<Level>((header >> 3u) & 0x03u)});
+        }
+    }
+
+private:
+
+    static uint8_t next(uint8_t const position) {
+        return static_cast<uint8_t>((position + 1) % capacity);
+    }
+
+    static uint8_t writeVarint(uint8_t *const buffer, uint8_t length, uint32_t value) {
+        while (value >= 0x80u) {
+            buffer[length++] = static_cast<uint8_t>(value | 0x80u);
+            value >>= 7u;
+        }
+        buffer[length++] = static_cast<uint8_t>(value);
+        return length;
+    }
+
+    uint32_t readVarint(uint8_t &position) const {
+        uint32_t value = 0;
+        uint8_t shift = 0;
+        uint8_t byte;
+        do {
+            byte = bytes[position];
+            position = AtoDispenseJournal::next(position);
+            value |= static_cast<uint32_t>(byte & 0x7Fu) << shift;
+            shift = static_cast<uint8_t>(shift + 7);
+        } while ((byte & 0x80u) && shift < 35);
+        return value;
+    }
+
+    void dropOldest() {
+        uint8_t position = AtoDispenseJournal::next(head);
+        AtoDispenseJournal::readVarint(position);
+        AtoDispenseJournal::readVarint(position);
+
+        used = static_cast<uint8_t>(used - (position + capacity - head) % capacity);
+        head = position;
+        --count;
+
+        if (count > 0) {
+            position = AtoDispenseJournal::next(head);
+            oldestStartS += AtoDispenseJournal::readVarint(position);
+        }
+    }
+};
+
+#endif
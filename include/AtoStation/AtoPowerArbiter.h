@@ -0,0 +1,53 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ATO_STATION_ATO_POWER_ARBITER_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ATO_STATION_ATO_POWER_ARBITER_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * <br/>
+ * Concrete class, limits how many ATO dispensers run at once on a shared pump supply.<br/>
+ * A station holds a slot from the start to the end of a dispense. A station due to dispense without a free slot
+ * waits in <tt>Sensing</tt> and starts in the first loop a slot is free. The minimum dispensing interval
+ * keeps a station that just finished from taking the slot again before the waiting ones.
+ */
+class AtoPowerArbiter {
+
+    uint8_t maxRunningCount;
+    uint8_t runningCount = 0;
+
+public:
+
+    /**
+     * @param maxRunningCount – dispensers the supply can power at once
+     */
+    explicit AtoPowerArbiter(uint8_t const maxRunningCount = 1) :
+            maxRunningCount(maxRunningCount) {}
+
+    bool hasFreeSlot() const {
+        return runningCount < maxRunningCount;
+    }
+
+    /**
+     * @return <tt>false</tt> if all slots are taken
+     */
+    bool acquire() {
+        if (!AtoPowerArbiter::hasFreeSlot()) {
+            return false;
+        }
+        ++runningCount;
+        return true;
+    }
+
+    void release() {
+        if (runningCount > 0) {
+            --runningCount;
+        }
+    }
+
+    uint8_t getRunningCount() const {
+        return runningCount;
+    }
+};
+
+#endif
@@ -14,6 +14,18 @@ struct AtoSettings {
     uint32_t minDispensingIntervalMs = 15ul * 60ul * 1000ul;    // 15 min * 60 sec * 1000 ms
     uint32_t maxDispensingDurationMs = 90ul * 1000ul;           // 90 sec * 1000 ms
 
+    /**
+     * Adaptive dispensing, off by default.
+     * With enough recorded top-offs the station learns the evaporation and
+     *  • waits until about targetDispensingDurationMs of water is missing, within [minDispensingIntervalMs, maxDispensingIntervalMs]
+     *  • fails the top-off at twice the expected run time, within [minDispensingDurationMs, maxDispensingDurationMs]
+     */
+    bool isAdaptive = false;
+    uint8_t minAdaptiveSamples = 3;
+    uint32_t maxDispensingIntervalMs = 4ul * 60ul * 60ul * 1000ul; // 4 h * 60 min * 60 sec * 1000 ms
+    uint32_t targetDispensingDurationMs = 30ul * 1000ul;           // 30 sec * 1000 ms
+    uint32_t minDispensingDurationMs = 10ul * 1000ul;              // 10 sec * 1000 ms
+
     explicit AtoSettings() = default;
 
     AtoSettings(uint32_t minDispensingIntervalMs, uint32_t maxDispensingDurationMs) :
@@ -4,27 +4,57 @@
 
 #include <Enums/AlarmCode.h>
 #include <Enums/AlarmSeverity.h>
+#include <Enums/AtoDispenseEnd.h>
+#include <Enums/AtoEvent.h>
 #include <Enums/AtoStationState.h>
 #include <Enums/Level.h>
 
+#include <Common/StateMachine.h>
 #include <Common/Switchable.h>
 #include <Abstract/AbstractRunnable.h>
 #include <Abstract/AbstractSleepable.h>
 
-#include <AlarmStation/AlarmStation.h>
+#include <AlarmStation/AbstractAlarmStation.h>
 
+#include "AtoAlarmCodes.h"
+#include "AtoDispenseHistory.h"
+#include "AtoDispenseJournal.h"
+#include "AtoPowerArbiter.h"
 #include "AtoSettings.h"
 
+/**
+ * <br/>
+ * Event driven, the behaviour is the transition table in <tt>AtoStation::transitions()</tt>.<br/>
+ * Level setters post <tt>LevelChanged</tt>, every state change posts <tt>StateEntered</tt>
+ * and the single timer (dispensing interval, dispensing duration or sleep) posts <tt>TimerElapsed</tt>.<br/>
+ * A loop without pending events only compares the timer, no level is re-evaluated and no alarm is touched.<br/>
+ * Events are handled one loop after they are posted, i.e. each transition takes one loop as before.<br/>
+ * Every top-off ended by the normal level is recorded in <tt>AtoDispenseHistory</tt>,
+ * with <tt>AtoSettings::isAdaptive</tt> the interval and the top-off failed time are derived from it.<br/>
+ * Every dispense, however it ended, is appended to <tt>AtoDispenseJournal</tt>.<br/>
+ * Several stations run side by side with their own <tt>AtoAlarmCodes</tt>, an optional <tt>AtoPowerArbiter</tt>
+ * on a shared pump supply and their levels from one <tt>AbstractAtoLevelBank</tt>.
+ */
 class AtoStation :
         public AbstractRunnable,
         public AbstractSleepable {
 
+public:
+
+    using Machine = StateMachine<AtoStation, AtoStationState, AtoEvent>;
+    using Transitions = StateTransition<AtoStation, AtoStationState>[10];
+
 private:
 
     AtoSettings &atoSettings;
     Switchable &atoDispenser;
 
-    AlarmStation *pAlarmStation = nullptr;
+    AbstractAlarmStation *pAlarmStation = nullptr;
+    AtoAlarmCodes alarmCodes;
+
+    AtoPowerArbiter *pPowerArbiter = nullptr;
+    bool hasPower = false;
+    bool isWaitingForPower = false;
 
     Level normalLevelState = Level::Unknown;
     Level highLevelState = Level::Unknown;
@@ -33,79 +63,172 @@ private:
 
     uint32_t currentMillis = 0;
     uint32_t dispensingStartMs = 0;
+    uint32_t completedStartMs = 0;
+    bool hasCompletedTopOff = false;
 
-    AtoStationState atoStationState = AtoStationState::Invalid;
+    AtoDispenseHistory dispenseHistory;
+    AtoDispenseJournal dispenseJournal;
+
+    uint32_t timerStartMs = 0;
+    uint32_t timerDurationMs = 0;
+    bool isTimerArmed = false;
+
+    Machine stateMachine;
     bool hasTopOffFailed = false;
 
 public:
 
     /* § Section: Public Methods */
 
-    explicit AtoStation(AtoSettings &atoSettings, Switchable &atoDispenserToAttach) :
+    /**
+     * @param atoSettings – dispensing settings
+     * @param atoDispenserToAttach – pump or valve
+     * @param alarmCodes – codes raised by this station, see <tt>AtoAlarmCodes::forStation<index>()</tt>
+     */
+    explicit AtoStation(AtoSettings &atoSettings, Switchable &atoDispenserToAttach, AtoAlarmCodes const alarmCodes = AtoAlarmCodes{}) :
             atoSettings(atoSettings),
-            atoDispenser(atoDispenserToAttach) {}
+            atoDispenser(atoDispenserToAttach),
+            alarmCodes(alarmCodes),
+            stateMachine(AtoStation::transitions(), AtoStationState::Invalid) {}
 
     ~AtoStation() = default;
 
     AtoStationState const &getState() const {
-        return atoStationState;
+        return stateMachine.getState();
     }
 
     bool isInState(AtoStationState const &compareState) const {
-        return atoStationState == compareState;
+        return stateMachine.isInState(compareState);
+    }
+
+    Machine const &getStateMachine() const {
+        return stateMachine;
+    }
+
+    AtoDispenseHistory const &getDispenseHistory() const {
+        return dispenseHistory;
     }
 
-    void attachAlarmStation(AlarmStation *const pAlarmStation) {
+    AtoDispenseJournal const &getDispenseJournal() const {
+        return dispenseJournal;
+    }
+
+    /**
+     * <br/>
+     * Minimum time between top-off starts, learned when adaptive.
+     */
+    uint32_t getDispensingIntervalMs() const {
+        if (!AtoStation::isAdapting()) {
+            return atoSettings.minDispensingIntervalMs;
+        }
+        return AtoStation::clamp(
+                dispenseHistory.getIntervalForDurationMs(atoSettings.targetDispensingDurationMs),
+                atoSettings.minDispensingIntervalMs,
+                atoSettings.maxDispensingIntervalMs);
+    }
+
+    /**
+     * <br/>
+     * Pump run time after which the top-off fails, learned when adaptive.
+     */
+    uint32_t getMaxDispensingDurationMs() const {
+        if (!AtoStation::isAdapting()) {
+            return atoSettings.maxDispensingDurationMs;
+        }
+        uint32_t expectedMs = dispenseHistory.getDurationForIntervalMs(AtoStation::getDispensingIntervalMs());
+        uint32_t longestMs = dispenseHistory.getLongestDurationMs();
+        return AtoStation::clamp(
+                2 * (expectedMs > longestMs ? expectedMs : longestMs),
+                atoSettings.minDispensingDurationMs,
+                atoSettings.maxDispensingDurationMs);
+    }
+
+    void attachAlarmStation(AbstractAlarmStation *const pAlarmStation) {
         if (pAlarmStation != nullptr) {
             AtoStation::pAlarmStation = pAlarmStation;
         }
     }
 
+    AtoAlarmCodes const &getAlarmCodes() const {
+        return alarmCodes;
+    }
+
+    /**
+     * <br/>
+     * Dispensing starts only with a free slot, the slot is held until the dispenser is switched off.
+     */
+    void attachPowerArbiter(AtoPowerArbiter *const pPowerArbiter) {
+        if (pPowerArbiter != nullptr) {
+            AtoStation::pPowerArbiter = pPowerArbiter;
+        }
+    }
+
     void setNormalLevelState(Level const level) {
-        AtoStation::normalLevelState = level;
+        AtoStation::setLevel(normalLevelState, level);
     }
 
     void setHighLevelState(Level const level) {
-        AtoStation::highLevelState = level;
+        AtoStation::setLevel(highLevelState, level);
     }
 
     void setLowLevelState(Level const level) {
-        AtoStation::lowLevelState = level;
+        AtoStation::setLevel(lowLevelState, level);
     }
 
     void setReservoirLevelState(Level const level) {
-        AtoStation::reservoirLevelState = level;
+        AtoStation::setLevel(reservoirLevelState, level);
     }
 
     void startSleeping(uint32_t const &sleepMs) override {
         AbstractSleepable::startSleeping(sleepMs);
 
-        AtoStation::stopDispensing();
-        AtoStation::setState(AtoStationState::Sleeping);
+        if (stateMachine.isInState(AtoStationState::Dispensing)) {
+            AtoStation::syncMillis();
+            AtoStation::endDispensing(AtoDispenseEnd::Sleep);
+        } else {
+            AtoStation::stopDispensing();
+        }
+        AtoStation::enterState(AtoStationState::Sleeping);
+        AtoStation::startTimer(sleepStartMs, sleepMs);
         AtoStation::deleteAllStationAlarms();
     }
 
     void stopSleeping() override {
         AbstractSleepable::stopSleeping();
-        AtoStation::setState(AtoStationState::Sensing);
+        AtoStation::enterState(AtoStationState::Sensing);
     }
 
     void reset() {
         AtoStation::deleteAllStationAlarms();
-        AtoStation::setState(AtoStationState::Sensing);
+        AtoStation::enterState(AtoStationState::Sensing);
     }
 
     void setup() override {
         delay(10);
         AtoStation::syncMillis();
-        AtoStation::setState(AtoStationState::Sensing);
+        AtoStation::enterState(AtoStationState::Sensing);
     }
 
     void loop() override {
-        //
+        AtoStation::syncMillis();
+
+        if (isTimerArmed && currentMillis - timerStartMs >= timerDurationMs) {
+            isTimerArmed = false;
+            stateMachine.post(AtoEvent::TimerElapsed);
+        }
+
+        if (isWaitingForPower && pPowerArbiter->hasFreeSlot()) {
+            isWaitingForPower = false;
+            stateMachine.post(AtoEvent::PowerAvailable);
+        }
+
+        if (!stateMachine.hasPendingEvents()) {
+            return;
+        }
+
 #ifdef __SERIAL_DEBUG__
         Serial << "------------------------------------------------\n";
-        Serial << "\tatoStationState: \t" << getAtoStationStateString(atoStationState) << "\n";
+        Serial << "\tatoStationState: \t" << getAtoStationStateString(stateMachine.getState()) << "\n";
         Serial << "------------------------------------------------\n";
         Serial << "\thighLevelState: \t" << getLiquidStateString(highLevelState) << "\n";
         Serial << "\tnormalLevelState: \t" << getLiquidStateString(normalLevelState) << "\n";
@@ -114,156 +237,231 @@ public:
         Serial << "\tAtoDispenser: \t" << getAtoDispenserStateString(atoDispenser.getState()) << "\n";
 #endif
 
-        AtoStation::syncMillis();
+        if (stateMachine.dispatch(*this)) {
+            stateMachine.post(AtoEvent::StateEntered);
+        }
+    }
 
-        switch (atoStationState) {
-            //
-            case AtoStationState::Sleeping:
-                //
-                if (AbstractSleepable::shouldStopSleeping()) {
-                    AtoStation::stopSleeping();
-                }
+private:
 
-                break;
+/* § Section: Transition Table */
+
+    static Transitions const &transitions() {
+        static constexpr uint8_t anyEvent = Machine::on(AtoEvent::LevelChanged, AtoEvent::StateEntered, AtoEvent::TimerElapsed, AtoEvent::PowerAvailable);
+        static constexpr uint8_t levelOrEntry = Machine::on(AtoEvent::LevelChanged, AtoEvent::StateEntered);
+
+        static constexpr Transitions table = {
+                /* Sensing, level alarms are raised or acknowledged on every evaluation */
+                {AtoStationState::Sensing, anyEvent, &AtoStation::isLevelFaulted, &AtoStation::syncLevelAlarms, AtoStationState::Alarming},
+                {AtoStationState::Sensing, anyEvent, &AtoStation::canStartDispensing, &AtoStation::syncAndStartDispensing, AtoStationState::Dispensing},
+                {AtoStationState::Sensing, anyEvent, nullptr, &AtoStation::syncAndWaitForInterval, AtoStationState::Sensing},
+                /* Dispensing */
+                {AtoStationState::Dispensing, anyEvent, &AtoStation::isHighLevelHigh, &AtoStation::stopOnHighLevel, AtoStationState::Alarming},
+                {AtoStationState::Dispensing, anyEvent, &AtoStation::isLowLevelLow, &AtoStation::stopOnLowLevel, AtoStationState::Alarming},
+                {AtoStationState::Dispensing, anyEvent, &AtoStation::isNormalLevelHigh, &AtoStation::stopOnNormalLevel, AtoStationState::Sensing},
+                {AtoStationState::Dispensing, anyEvent, &AtoStation::isDispensingTimeUp, &AtoStation::stopOnTopOffFailed, AtoStationState::Alarming},
+                /* Alarming */
+                {AtoStationState::Alarming, levelOrEntry, &AtoStation::isAlarmCleared, &AtoStation::syncAlarmingAlarms, AtoStationState::Sensing},
+                {AtoStationState::Alarming, levelOrEntry, nullptr, &AtoStation::syncAlarmingAlarms, AtoStationState::Alarming},
+                /* Sleeping, levels are ignored */
+                {AtoStationState::Sleeping, Machine::on(AtoEvent::TimerElapsed), nullptr, &AtoStation::wakeUp, AtoStationState::Sensing},
+        };
+        return table;
+    }
 
-            case AtoStationState::Sensing:
-                //
-                if (reservoirLevelState == Level::Low) {
-                    AtoStation::setState(AtoStationState::Alarming);
-                    AtoStation::raiseAlarm(AlarmCode::AtoReservoirLow, AlarmSeverity::Major);
-                } else {
-                    AtoStation::acknowledgeAlarm(AlarmCode::AtoReservoirLow);
-                }
-
-                if (highLevelState == Level::High) {
-                    AtoStation::setState(AtoStationState::Alarming);
-                    AtoStation::raiseAlarm(AlarmCode::AtoHighLevel, AlarmSeverity::Major);
-                } else {
-                    AtoStation::acknowledgeAlarm(AlarmCode::AtoHighLevel);
-                }
-
-                if (lowLevelState == Level::Low) {
-                    AtoStation::setState(AtoStationState::Alarming);
-                    AtoStation::raiseAlarm(AlarmCode::AtoLowLevel, AlarmSeverity::Major);
-                } else {
-                    AtoStation::acknowledgeAlarm(AlarmCode::AtoLowLevel);
-                }
-
-                switch (normalLevelState) {
-                    case Level::High:
-                        AtoStation::acknowledgeAlarm(AlarmCode::AtoTopOffFailed);
-                        break;
-
-                    case Level::Low:
-                        if (!AtoStation::isInState(AtoStationState::Alarming) &&
-                            (dispensingStartMs == 0 || ((currentMillis - dispensingStartMs) >= atoSettings.minDispensingIntervalMs))) {
-                            //
-                            AtoStation::setState(AtoStationState::Dispensing);
-                            AtoStation::startDispensing();
-                        }
-                        break;
-
-                    case Level::Unknown:
-                        break;
-                }
-
-                break;
+/* § Section: Guards */
 
-            case AtoStationState::Dispensing:
-                //
-                if (highLevelState == Level::High) {
-                    AtoStation::stopDispensing();
-                    AtoStation::setState(AtoStationState::Alarming);
-                    AtoStation::raiseAlarm(AlarmCode::AtoHighLevel, AlarmSeverity::Major);
-                    break;
-                }
-
-                if (lowLevelState == Level::Low) {
-                    AtoStation::stopDispensing();
-                    AtoStation::setState(AtoStationState::Alarming);
-                    AtoStation::raiseAlarm(AlarmCode::AtoLowLevel, AlarmSeverity::Major);
-                    break;
-                }
-
-                if (normalLevelState == Level::High) {
-                    AtoStation::stopDispensing();
-                    AtoStation::setState(AtoStationState::Sensing);
-                } else if ((currentMillis - dispensingStartMs) >= atoSettings.maxDispensingDurationMs) {
-                    //
-                    AtoStation::stopDispensing();
-                    hasTopOffFailed = true;
-                    AtoStation::setState(AtoStationState::Alarming);
-                    AtoStation::raiseAlarm(AlarmCode::AtoTopOffFailed, AlarmSeverity::Major);
-                    break;
-                }
-
-                break;
+    bool isLevelFaulted() const {
+        return reservoirLevelState == Level::Low || highLevelState == Level::High || lowLevelState == Level::Low;
+    }
 
-            case AtoStationState::Alarming:
-                //
-                if (reservoirLevelState == Level::High) {
-                    AtoStation::acknowledgeAlarm(AlarmCode::AtoReservoirLow);
-                } else if (reservoirLevelState == Level::Low) {
-                    AtoStation::raiseAlarm(AlarmCode::AtoReservoirLow, AlarmSeverity::Major);
-                }
-
-                if (highLevelState == Level::Low) {
-                    AtoStation::acknowledgeAlarm(AlarmCode::AtoHighLevel);
-                } else if (highLevelState == Level::High) {
-                    AtoStation::raiseAlarm(AlarmCode::AtoHighLevel, AlarmSeverity::Major);
-                }
-
-                if (lowLevelState == Level::High) {
-                    AtoStation::acknowledgeAlarm(AlarmCode::AtoLowLevel);
-                } else if (lowLevelState == Level::Low) {
-                    AtoStation::raiseAlarm(AlarmCode::AtoLowLevel, AlarmSeverity::Major);
-                }
-
-                if ((highLevelState == Level::Low || highLevelState == Level::Unknown) &&
-                    (lowLevelState == Level::High || lowLevelState == Level::Unknown) &&
-                    (reservoirLevelState == Level::High || reservoirLevelState == Level::Unknown) &&
-                    (normalLevelState == Level::High || !hasTopOffFailed)) {
-                    //
-                    AtoStation::setState(AtoStationState::Sensing);
-                }
-
-                break;
+    bool isDispensingIntervalElapsed() const {
+        return dispensingStartMs == 0 || (currentMillis - dispensingStartMs) >= AtoStation::getDispensingIntervalMs();
+    }
 
-            default:
-                break;
+    bool canStartDispensing() const {
+        return normalLevelState == Level::Low && AtoStation::isDispensingIntervalElapsed() && AtoStation::isPowerAvailable();
+    }
+
+    bool isPowerAvailable() const {
+        return pPowerArbiter == nullptr || pPowerArbiter->hasFreeSlot();
+    }
+
+    bool isHighLevelHigh() const {
+        return highLevelState == Level::High;
+    }
+
+    bool isLowLevelLow() const {
+        return lowLevelState == Level::Low;
+    }
+
+    bool isNormalLevelHigh() const {
+        return normalLevelState == Level::High;
+    }
+
+    bool isDispensingTimeUp() const {
+        return (currentMillis - dispensingStartMs) >= AtoStation::getMaxDispensingDurationMs();
+    }
+
+    bool isAlarmCleared() const {
+        return (highLevelState == Level::Low || highLevelState == Level::Unknown) &&
+               (lowLevelState == Level::High || lowLevelState == Level::Unknown) &&
+               (reservoirLevelState == Level::High || reservoirLevelState == Level::Unknown) &&
+               (normalLevelState == Level::High || !hasTopOffFailed);
+    }
+
+/* § Section: Actions */
+
+    void syncLevelAlarms() {
+        if (reservoirLevelState == Level::Low) {
+            AtoStation::raiseAlarm(alarmCodes.reservoirLow, AlarmSeverity::Major);
+        } else {
+            AtoStation::acknowledgeAlarm(alarmCodes.reservoirLow);
+        }
+
+        if (highLevelState == Level::High) {
+            AtoStation::raiseAlarm(alarmCodes.highLevel, AlarmSeverity::Major);
+        } else {
+            AtoStation::acknowledgeAlarm(alarmCodes.highLevel);
+        }
+
+        if (lowLevelState == Level::Low) {
+            AtoStation::raiseAlarm(alarmCodes.lowLevel, AlarmSeverity::Major);
+        } else {
+            AtoStation::acknowledgeAlarm(alarmCodes.lowLevel);
+        }
+
+        if (normalLevelState == Level::High) {
+            AtoStation::acknowledgeAlarm(alarmCodes.topOffFailed);
         }
     }
 
-private:
+    void syncAndStartDispensing() {
+        AtoStation::syncLevelAlarms();
+        AtoStation::startDispensing();
+    }
+
+    void syncAndWaitForInterval() {
+        AtoStation::syncLevelAlarms();
+        if (normalLevelState != Level::Low) {
+            return;
+        }
+        if (AtoStation::isDispensingIntervalElapsed()) {
+            isWaitingForPower = true; // <- only the power slot is missing
+        } else {
+            AtoStation::startTimer(dispensingStartMs, AtoStation::getDispensingIntervalMs());
+        }
+    }
+
+    void stopOnNormalLevel() {
+        AtoStation::endDispensing(AtoDispenseEnd::NormalLevel);
+        if (hasCompletedTopOff) {
+            dispenseHistory.record(currentMillis - dispensingStartMs, dispensingStartMs - completedStartMs);
+        }
+        completedStartMs = dispensingStartMs;
+        hasCompletedTopOff = true;
+    }
+
+    void stopOnHighLevel() {
+        AtoStation::endDispensing(AtoDispenseEnd::HighLevel);
+        AtoStation::raiseAlarm(alarmCodes.highLevel, AlarmSeverity::Major);
+    }
+
+    void stopOnLowLevel() {
+        AtoStation::endDispensing(AtoDispenseEnd::LowLevel);
+        AtoStation::raiseAlarm(alarmCodes.lowLevel, AlarmSeverity::Major);
+    }
+
+    void stopOnTopOffFailed() {
+        AtoStation::endDispensing(AtoDispenseEnd::Timeout);
+        hasTopOffFailed = true;
+        AtoStation::raiseAlarm(alarmCodes.topOffFailed, AlarmSeverity::Major);
+    }
+
+    void syncAlarmingAlarms() {
+        if (reservoirLevelState == Level::High) {
+            AtoStation::acknowledgeAlarm(alarmCodes.reservoirLow);
+        } else if (reservoirLevelState == Level::Low) {
+            AtoStation::raiseAlarm(alarmCodes.reservoirLow, AlarmSeverity::Major);
+        }
+
+        if (highLevelState == Level::Low) {
+            AtoStation::acknowledgeAlarm(alarmCodes.highLevel);
+        } else if (highLevelState == Level::High) {
+            AtoStation::raiseAlarm(alarmCodes.highLevel, AlarmSeverity::Major);
+        }
+
+        if (lowLevelState == Level::High) {
+            AtoStation::acknowledgeAlarm(alarmCodes.lowLevel);
+        } else if (lowLevelState == Level::Low) {
+            AtoStation::raiseAlarm(alarmCodes.lowLevel, AlarmSeverity::Major);
+        }
+    }
+
+    void wakeUp() {
+        AbstractSleepable::stopSleeping();
+    }
 
 /* § Section: Private Methods */
 
+    static uint32_t clamp(uint32_t const value, uint32_t const low, uint32_t const high) {
+        return value < low ? low : (value > high ? high : value);
+    }
+
+    bool isAdapting() const {
+        return atoSettings.isAdaptive && dispenseHistory.size() >= atoSettings.minAdaptiveSamples;
+    }
+
     inline void syncMillis() {
         AtoStation::currentMillis = millis();
     }
 
+    void setLevel(Level &levelState, Level const level) {
+        if (levelState != level) {
+            levelState = level;
+            stateMachine.post(AtoEvent::LevelChanged);
+        }
+    }
+
+    /**
+     * <br/>
+     * State change outside the table, evaluated on the next loop.
+     */
+    void enterState(AtoStationState const newState) {
+        isTimerArmed = false;
+        isWaitingForPower = false;
+        stateMachine.setState(newState);
+        stateMachine.post(AtoEvent::StateEntered);
+    }
+
+    void startTimer(uint32_t const startMs, uint32_t const durationMs) {
+        timerStartMs = startMs;
+        timerDurationMs = durationMs;
+        isTimerArmed = true;
+    }
+
     void raiseAlarm(AlarmCode const &alarmCode, AlarmSeverity const &alarmSeverity) const {
         if (pAlarmStation != nullptr) {
-            pAlarmStation->alarmList.add(alarmCode, alarmSeverity);
+            pAlarmStation->raiseAlarm(alarmCode, alarmSeverity);
         }
     }
 
     void acknowledgeAlarm(AlarmCode const alarmCode) const {
         if (pAlarmStation != nullptr) {
-            pAlarmStation->alarmList.acknowledge(alarmCode);
+            pAlarmStation->clearAlarm(alarmCode);
         }
     }
 
     void deleteAlarm(AlarmCode const alarmCode) const {
         if (pAlarmStation != nullptr) {
-            pAlarmStation->alarmList.remove(alarmCode);
+            pAlarmStation->removeAlarm(alarmCode);
         }
     }
 
     void deleteAllStationAlarms() const {
-        AtoStation::deleteAlarm(AlarmCode::AtoTopOffFailed);
-        AtoStation::deleteAlarm(AlarmCode::AtoHighLevel);
-        AtoStation::deleteAlarm(AlarmCode::AtoLowLevel);
+        AtoStation::deleteAlarm(alarmCodes.topOffFailed);
+        AtoStation::deleteAlarm(alarmCodes.highLevel);
+        AtoStation::deleteAlarm(alarmCodes.lowLevel);
     }
 
     void startDispensing() {
@@ -271,18 +469,29 @@ private:
         Serial << "\t\tAtoStation::startDispensing()\n";
 #endif
         dispensingStartMs = currentMillis;
+        hasPower = pPowerArbiter != nullptr && pPowerArbiter->acquire();
         atoDispenser.setState(Switched::On);
+        AtoStation::startTimer(dispensingStartMs, AtoStation::getMaxDispensingDurationMs());
     }
 
     void stopDispensing() {
 #ifdef __SERIAL_DEBUG__
         Serial << "\t\tAtoStation::stopDispensing()\n";
 #endif
+        isTimerArmed = false;
         atoDispenser.setState(Switched::Off);
+        if (hasPower) {
+            hasPower = false;
+            pPowerArbiter->release();
+        }
     }
 
-    void setState(AtoStationState const newAtoStationState) {
-        atoStationState = newAtoStationState;
+    void endDispensing(AtoDispenseEnd const reason) {
+        AtoStation::stopDispensing();
+        dispenseJournal.record(dispensingStartMs, currentMillis - dispensingStartMs, reason, reservoirLevelState);
+        if (reason != AtoDispenseEnd::NormalLevel) {
+            hasCompletedTopOff = false; // <- the next interval would span the failed cycle too, not sampled
+        }
     }
 
 #ifdef __SERIAL_DEBUG__
@@ -0,0 +1,103 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_COMMON_BUZZER_PATTERN_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_BUZZER_PATTERN_H_
+#pragma once
+
+#include <stdint.h>
+
+#include "Enums/AlarmCode.h"
+#include "Enums/AlarmSeverity.h"
+
+#ifndef BUZZER_PATTERN_STEP_MS
+#define BUZZER_PATTERN_STEP_MS 100
+#endif
+
+static_assert(ALARM_CODE_COUNT <= 28, "BuzzerPattern::forAlarm fits codes below 28 in 32 steps");
+
+/**
+ * <br/>
+ * Up to 32 steps of <tt>BUZZER_PATTERN_STEP_MS</tt>, bit <tt>n</tt> is the buzzer in step <tt>n</tt>, 5 bytes.<br/>
+ * <tt>forAlarm</tt> encodes which alarm is sounding, to be told apart by ear:
+ * <ul>
+ * <li>a long tone for the severity, the longer the more severe, none for <tt>NoSeverity</tt></li>
+ * <li>the alarm code as decimal digits, a medium beep per ten, a short beep per unit</li>
+ * </ul>
+ * e.g. <tt>AtoHighLevel</tt> (8), Major: 400 ms tone, pause, 8 short beeps.
+ */
+class BuzzerPattern {
+
+public:
+
+    static constexpr uint8_t maxLength = 32;
+
+private:
+
+    uint32_t bits = 0;
+    uint8_t length = 0;
+
+public:
+
+    BuzzerPattern() = default;
+
+    BuzzerPattern(uint32_t const bits, uint8_t const length) :
+            bits(bits),
+            length(length < maxLength ? length : maxLength) {}
+
+    uint32_t getBits() const {
+        return bits;
+    }
+
+    uint8_t getLength() const {
+        return length;
+    }
+
+    bool isEmpty() const {
+        return length == 0;
+    }
+
+    bool isOn(uint8_t const step) const {
+        return step < length && ((bits >> step) & 1ul);
+    }
+
+    /**
+     * <br/>
+     * Appends <tt>onSteps</tt> on and <tt>offSteps</tt> off, steps beyond <tt>maxLength</tt> are dropped.
+     */
+    BuzzerPattern &append(uint8_t const onSteps, uint8_t const offSteps) {
+        for (uint8_t step = 0; step < onSteps && length < maxLength; ++step) {
+            bits |= 1ul << length++;
+        }
+        for (uint8_t step = 0; step < offSteps && length < maxLength; ++step) {
+            ++length;
+        }
+        return *this;
+    }
+
+    /**
+     * <br/>
+     * Any code below 28 fits in 32 steps.
+     */
+    static BuzzerPattern forAlarm(AlarmCode const alarmCode, AlarmSeverity const alarmSeverity) {
+        /* on steps of the severity tone, per AlarmSeverity */
+        static const uint8_t severityToneSteps[] = {0, 2, 4, 6};
+
+        BuzzerPattern pattern{};
+        uint8_t toneSteps = severityToneSteps[static_cast<uint8_t>(alarmSeverity) & 0x03u];
+        if (toneSteps > 0) {
+            pattern.append(toneSteps, 2);
+        }
+
+        uint8_t code = static_cast<uint8_t>(alarmCode);
+        for (uint8_t ten = 0; ten < code / 10; ++ten) {
+            pattern.append(3, 1);
+        }
+        if (code >= 10) {
+            pattern.append(0, 1);
+        }
+        for (uint8_t unit = 0; unit < code % 10; ++unit) {
+            pattern.append(1, 1);
+        }
+        return pattern;
+    }
+};
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_COMMON_CENTI_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_CENTI_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * <br/>
+ * Concrete class.<br/>
+ * Fixed-point value in hundredths of a unit (centi-degrees, centi-percent) stored in <tt>int16_t</tt>,
+ * range <tt>-327.68 .. 327.67</tt>.<br/>
+ * The micro-controller has no FPU, comparisons and arithmetic stay in integer instructions.<br/>
+ * Convert from/to <tt>float</tt> only at the edges, i.e. settings literals and display/serial output.
+ * \code
+ *     constexpr Centi stopWaterHeatingAt = Centi::fromFloat(24.4f); // <- folded at compile time
+ *     Centi reading = Centi::fromRaw(2437);                         // <- 24.37
+ * \endcode
+ */
+class Centi {
+
+private:
+
+    int16_t raw;
+
+    constexpr explicit Centi(int16_t const raw, bool) : raw(raw) {}
+
+public:
+
+    constexpr Centi() : raw(0) {}
+
+    /**
+     * @param raw – value in hundredths
+     */
+    static constexpr Centi fromRaw(int16_t const raw) {
+        return Centi(raw, true);
+    }
+
+    /**
+     * @param whole – value in units
+     */
+    static constexpr Centi fromWhole(int16_t const whole) {
+        return Centi(static_cast<int16_t>(whole * 100), true);
+    }
+
+    /**
+     * <br/>
+     * Rounds to the nearest hundredth, use with literals so the conversion is folded at compile time.
+     */
+    static constexpr Centi fromFloat(float const value) {
+        return Centi(static_cast<int16_t>(value < 0 ? value * 100.0f - 0.5f : value * 100.0f + 0.5f), true);
+    }
+
+    constexpr int16_t getRaw() const {
+        return raw;
+    }
+
+    /**
+     * <br/>
+     * Display/serial edge only.
+     */
+    float toFloat() const {
+        return raw / 100.0f;
+    }
+
+    /* § Section: Comparison */
+
+    constexpr bool operator==(Centi const &rhs) const { return raw == rhs.raw; }
+
+    constexpr bool operator!=(Centi const &rhs) const { return raw != rhs.raw; }
+
+    constexpr bool operator<(Centi const &rhs) const { return raw < rhs.raw; }
+
+    constexpr bool operator<=(Centi const &rhs) const { return raw <= rhs.raw; }
+
+    constexpr bool operator>(Centi const &rhs) const { return raw > rhs.raw; }
+
+    constexpr bool operator>=(Centi const &rhs) const { return raw >= rhs.raw; }
+
+    /* § Section: Arithmetic */
+
+    constexpr Centi operator+(Centi const &rhs) const { return Centi(static_cast<int16_t>(raw + rhs.raw), true); }
+
+    constexpr Centi operator-(Centi const &rhs) const { return Centi(static_cast<int16_t>(raw - rhs.raw), true); }
+
+    constexpr Centi operator-() const { return Centi(static_cast<int16_t>(-raw), true); }
+
+    Centi &operator+=(Centi const &rhs) {
+        raw = static_cast<int16_t>(raw + rhs.raw);
+        return *this;
+    }
+
+    Centi &operator-=(Centi const &rhs) {
+        raw = static_cast<int16_t>(raw - rhs.raw);
+        return *this;
+    }
+};
+
+#endif
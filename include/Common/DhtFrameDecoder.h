@@ -0,0 +1,142 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_COMMON_DHT_FRAME_DECODER_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_DHT_FRAME_DECODER_H_
+#pragma once
+
+#include <stdint.h>
+#include <Enums/DhtModel.h>
+#include <Enums/DhtReadStatus.h>
+
+/**
+ * <br/>
+ * Concrete class.<br/>
+ * Hardware independent capture and decoding of a DHT frame from falling edge timestamps.<br/>
+ * After the host start signal the sensor pulls the line low for 80 µs and high for 80 µs,
+ * then sends 40 bits, each as 50 µs low followed by 26–28 µs high for <tt>0</tt> or 70 µs high for <tt>1</tt>.<br/>
+ * The interval between two falling edges is therefore ~160 µs for the response, ~78 µs for <tt>0</tt>
+ * and ~120 µs for <tt>1</tt>, the frame is complete after 42 falling edges.<br/>
+ * Call <tt>onFallingEdge(uint16_t us)</tt> from the interrupt service routine, <tt>decode()</tt> from the loop.
+ */
+class DhtFrameDecoder {
+
+public:
+
+    static constexpr uint8_t frameEdges = 42;
+    static constexpr uint8_t frameBytes = 5;
+
+private:
+
+    static constexpr uint16_t minBitIntervalUs = 60;
+    static constexpr uint16_t oneBitIntervalUs = 100; // <- threshold between '0' and '1'
+    static constexpr uint16_t maxBitIntervalUs = 200;
+
+    volatile uint16_t edgeUs[frameEdges];
+    volatile uint8_t edgeCount = 0;
+    uint8_t data[frameBytes];
+
+public:
+
+    DhtFrameDecoder() : edgeUs{}, data{} {}
+
+    /**
+     * <br/>
+     * Discards captured edges, call before releasing the data line.
+     */
+    void reset() {
+        edgeCount = 0;
+    }
+
+    /**
+     * <br/>
+     * Interrupt safe, keeps only the lower 16 bits of <tt>micros()</tt>, interval arithmetic handles the overflow.
+     *
+     * @param us – timestamp of the falling edge in microseconds
+     */
+    void onFallingEdge(uint16_t const us) {
+        if (edgeCount < frameEdges) {
+            edgeUs[edgeCount] = us;
+            edgeCount = edgeCount + 1;
+        }
+    }
+
+    bool isComplete() const {
+        return edgeCount >= frameEdges;
+    }
+
+    uint8_t getEdgeCount() const {
+        return edgeCount;
+    }
+
+    DhtReadStatus decode() {
+        if (edgeCount == 0) {
+            return DhtReadStatus::NoResponse;
+        }
+        if (edgeCount < frameEdges) {
+            return DhtReadStatus::Incomplete;
+        }
+
+        for (uint8_t index = 0; index < frameBytes; ++index) {
+            data[index] = 0;
+        }
+
+        /* edge 0 -> 1 is the sensor response, edges 1 -> 41 carry the bits */
+        for (uint8_t bit = 0; bit < 40; ++bit) {
+            uint16_t intervalUs = static_cast<uint16_t>(edgeUs[bit + 2] - edgeUs[bit + 1]);
+            if (intervalUs < minBitIntervalUs || intervalUs > maxBitIntervalUs) {
+                return DhtReadStatus::BadTiming;
+            }
+            data[bit >> 3u] = static_cast<uint8_t>(data[bit >> 3u] << 1u);
+            if (intervalUs > oneBitIntervalUs) {
+                data[bit >> 3u] |= 1u;
+            }
+        }
+
+        if (static_cast<uint8_t>(data[0] + data[1] + data[2] + data[3]) != data[4]) {
+            return DhtReadStatus::ChecksumMismatch;
+        }
+        return DhtReadStatus::Ok;
+    }
+
+    uint8_t getByte(uint8_t const index) const {
+        return data[index];
+    }
+
+    /**
+     * @param dhtModel – model of the DHT sensor
+     * @return relative humidity in tenths of percent
+     */
+    int16_t getHumidityDeci(DhtModel const dhtModel) const {
+        switch (dhtModel) {
+            case DhtModel::Dht11:
+            case DhtModel::Dht12:
+                return static_cast<int16_t>(data[0] * 10 + data[1]);
+            default:
+                return static_cast<int16_t>((data[0] << 8u) | data[1]);
+        }
+    }
+
+    /**
+     * @param dhtModel – model of the DHT sensor
+     * @return temperature in tenths of degree Celsius
+     */
+    int16_t getTemperatureDeci(DhtModel const dhtModel) const {
+        int16_t temperature;
+        bool negative;
+        switch (dhtModel) {
+            case DhtModel::Dht11:
+                temperature = static_cast<int16_t>(data[2] * 10 + (data[3] & 0x0Fu));
+                negative = (data[3] & 0x80u) != 0;
+                break;
+            case DhtModel::Dht12:
+                temperature = static_cast<int16_t>(data[2] * 10 + (data[3] & 0x7Fu));
+                negative = (data[3] & 0x80u) != 0;
+                break;
+            default:
+                temperature = static_cast<int16_t>(((data[2] & 0x7Fu) << 8u) | data[3]);
+                negative = (data[2] & 0x80u) != 0;
+                break;
+        }
+        return negative ? static_cast<int16_t>(-temperature) : temperature;
+    }
+};
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_COMMON_HYSTERESIS_SWITCH_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_HYSTERESIS_SWITCH_H_
+#pragma once
+
+#include <stdint.h>
+#include <Enums/Switched.h>
+
+/**
+ * <br/>
+ * Concrete class, the threshold and dwell logic shared by <tt>ThresholdController</tt> and <tt>AmbientStation</tt>.<br/>
+ * <tt>isDemanding</tt> is the two threshold decision, one instance per actuator keeps when it last switched
+ * so a switch waits for the minimum on/off time, the first switch is immediate.
+ * \code
+ *     isDemanding = HysteresisSwitch::isDemanding(reading, onThreshold, offThreshold, false, isDemanding);
+ *     if (heaterSwitch.getWaitMs(Switched::On, minOnMs, minOffMs, nowMs) == 0) {
+ *         heater.setState(Switched::On);
+ *         heaterSwitch.markSwitched(nowMs);
+ *     }
+ * \endcode
+ */
+class HysteresisSwitch {
+
+private:
+
+    uint32_t switchMs = 0;
+    bool hasSwitched = false;
+
+public:
+
+    /**
+     * @param value – current reading
+     * @param onThreshold – demand starts at <tt>value ≥ onThreshold</tt> (above) or <tt>value < onThreshold</tt> (below)
+     * @param offThreshold – demand stops at <tt>value < offThreshold</tt> (above) or <tt>value ≥ offThreshold</tt> (below)
+     * @param isAbove – <tt>true</tt> if high readings demand, e.g. a fan, <tt>false</tt> for a heater
+     * @param wasDemanding – previous result, selects the threshold
+     */
+    template<typename T>
+    static bool isDemanding(T const value, T const onThreshold, T const offThreshold, bool const isAbove, bool const wasDemanding) {
+        T const &threshold = wasDemanding ? offThreshold : onThreshold;
+        return isAbove ? !(value < threshold) : value < threshold;
+    }
+
+    /**
+     * @return time the switch to <tt>newState</tt> still has to wait, 0 if it may switch now
+     */
+    uint32_t getWaitMs(Switched const newState, uint32_t const minOnMs, uint32_t const minOffMs, uint32_t const nowMs) const {
+        if (!hasSwitched) {
+            return 0;
+        }
+        uint32_t dwellMs = newState == Switched::On ? minOffMs : minOnMs;
+        uint32_t elapsedMs = nowMs - switchMs;
+        return elapsedMs < dwellMs ? dwellMs - elapsedMs : 0;
+    }
+
+    void markSwitched(uint32_t const nowMs) {
+        switchMs = nowMs;
+        hasSwitched = true;
+    }
+};
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_COMMON_MULTICAST_FORWARDER_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_MULTICAST_FORWARDER_H_
+#pragma once
+
+#include <stdint.h>
+#include "Abstract/IForwarder.h"
+
+/**
+ * <br/>
+ * Concrete class.<br/>
+ * Fans out one sensor reading to up to <tt>N</tt> attached forwarders (connections) in a single pass.<br/>
+ * Attach it to a <tt>Sensor</tt> in place of a single connection, the sensor is read once per cycle
+ * no matter how many consumers use the value. No heap is used.
+ * \code
+ *     MulticastForwarder<float, 2> waterTemperatureForwarder{};
+ *     waterTemperatureForwarder.attach(waterTemperatureToAmbientStation);
+ *     waterTemperatureForwarder.attach(waterTemperatureToDisplay);
+ *     Sensor<float> waterTemperatureSensor{&waterTemperatureForwarder, -100.0f};
+ * \endcode
+ *
+ * @tparam T – forward data type
+ * @tparam N – max number of attached forwarders
+ */
+template<typename T, uint8_t N>
+class MulticastForwarder : public IForwarder<T> {
+
+private:
+
+    IForwarder<T> const *forwarders[N];
+    uint8_t count = 0;
+
+public:
+
+    explicit MulticastForwarder() : forwarders{} {}
+
+    ~MulticastForwarder() override = default;
+
+    uint8_t size() const {
+        return count;
+    }
+
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    bool isFull() const {
+        return count == N;
+    }
+
+    /**
+     * <br/>
+     * Attaches the forwarder, the same forwarder can be attached only once.
+     *
+     * @param forwarder – forwarder to be attached
+     * @return <tt>true</tt> if the forwarder was attached
+     */
+    bool attach(IForwarder<T> const &forwarder) {
+        if (count == N || contains(forwarder)) {
+            return false;
+        }
+        forwarders[count++] = &forwarder;
+        return true;
+    }
+
+    /**
+     * <br/>
+     * Detaches the forwarder, the order of the remaining forwarders is kept.
+     *
+     * @param forwarder – forwarder to be detached
+     * @return <tt>true</tt> if the forwarder was detached
+     */
+    bool detach(IForwarder<T> const &forwarder) {
+        for (uint8_t index = 0; index < count; ++index) {
+            if (forwarders[index] == &forwarder) {
+                --count;
+                for (; index < count; ++index) {
+                    forwarders[index] = forwarders[index + 1];
+                }
+                forwarders[count] = nullptr;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool contains(IForwarder<T> const &forwarder) const {
+        for (uint8_t index = 0; index < count; ++index) {
+            if (forwarders[index] == &forwarder) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void forward(T const &data) const override {
+        for (uint8_t index = 0; index < count; ++index) {
+            forwarders[index]->forward(data);
+        }
+    }
+
+    void forwardQuality(ReadingQuality const quality) const override {
+        for (uint8_t index = 0; index < count; ++index) {
+            forwarders[index]->forwardQuality(quality);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_COMMON_OVERSAMPLING_ACCUMULATOR_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_OVERSAMPLING_ACCUMULATOR_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * <br/>
+ * Concrete class.<br/>
+ * <a href="http://ww1.microchip.com/downloads/en/AppNotes/doc8003.pdf">AVR121: Enhancing ADC resolution by oversampling</a><br/>
+ * Sums <tt>4^extraBits</tt> raw samples and decimates the sum by <tt>extraBits</tt> shifts,
+ * each finished value has <tt>adcBits + extraBits</tt> bits of resolution.<br/>
+ * <tt>add(uint16_t sample)</tt> is meant to be called from the ADC interrupt,
+ * the loop reads the last finished value with <tt>getValue()</tt> and detects new values by <tt>getSequence()</tt>.<br/>
+ * Oversampling needs some noise (≥ 1 LSB) on the input, otherwise the extra bits stay zero.
+ */
+class OversamplingAccumulator {
+
+public:
+
+    static constexpr uint8_t maxExtraBits = 6; // <- 4096 samples of 10 bits still fit the sum
+
+private:
+
+    uint32_t sum = 0;
+    uint16_t count = 0;
+    uint8_t extraBits;
+    volatile uint16_t value = 0;
+    volatile uint8_t sequence = 0;
+
+public:
+
+    explicit OversamplingAccumulator(uint8_t const extraBits = 0) :
+            extraBits(extraBits > maxExtraBits ? maxExtraBits : extraBits) {}
+
+    uint8_t getExtraBits() const {
+        return extraBits;
+    }
+
+    /**
+     * <br/>
+     * Changes the oversampling and discards the partial sum, the last finished value is kept.
+     */
+    void setExtraBits(uint8_t const extraBits) {
+        OversamplingAccumulator::extraBits = extraBits > maxExtraBits ? maxExtraBits : extraBits;
+        sum = 0;
+        count = 0;
+    }
+
+    uint16_t getSamplesPerValue() const {
+        return static_cast<uint16_t>(1u << (2u * extraBits));
+    }
+
+    /**
+     * @param sample – raw converter result
+     * @return <tt>true</tt> when the sample finished a new decimated value
+     */
+    bool add(uint16_t const sample) {
+        sum += sample;
+        if (++count < OversamplingAccumulator::getSamplesPerValue()) {
+            return false;
+        }
+        value = static_cast<uint16_t>(sum >> extraBits);
+        sequence = static_cast<uint8_t>(sequence == UINT8_MAX ? 1 : sequence + 1);
+        sum = 0;
+        count = 0;
+        return true;
+    }
+
+    /**
+     * <br/>
+     * Last finished value, scaled to <tt>adcBits + extraBits</tt> bits.<br/>
+     * On 8-bit targets read it with interrupts disabled, the value is two bytes wide.
+     */
+    uint16_t getValue() const {
+        return value;
+    }
+
+    /**
+     * <br/>
+     * Incremented with every finished value, <tt>0</tt> only until the first one (wraps to <tt>1</tt>).
+     */
+    uint8_t getSequence() const {
+        return sequence;
+    }
+
+    bool hasValue() const {
+        return sequence != 0;
+    }
+};
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_COMMON_PID_CONTROLLER_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_PID_CONTROLLER_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * <br/>
+ * PID gains in Q8 fixed-point, output units per input unit, per sample.<br/>
+ * E.g. with <tt>Centi</tt> input and per mille output, <tt>kp = 2560</tt> is 10 ‰ per 0.01 °C.
+ */
+struct PidGains {
+    int16_t kp;
+    int16_t ki;
+    int16_t kd;
+};
+
+/**
+ * <br/>
+ * Concrete class, integer only PID, no soft-float.<br/>
+ * <ul>
+ * <li>called once per fixed sample period, the sample time is folded into <tt>ki</tt> and <tt>kd</tt></li>
+ * <li>derivative on measurement, no kick when the set point changes</li>
+ * <li>anti-windup: the integral term is clamped to <tt>[0, outputMax]</tt> and does not grow while the output saturates</li>
+ * </ul>
+ */
+class PidController {
+
+private:
+
+    PidGains gains;
+    uint16_t outputMax;
+    int32_t integralQ8 = 0;
+    int16_t lastMeasurement = 0;
+    bool hasLastMeasurement = false;
+
+    static int32_t clamp(int32_t const value, int32_t const low, int32_t const high) {
+        return value < low ? low : (value > high ? high : value);
+    }
+
+public:
+
+    /**
+     * @param gains – Q8 gains per sample
+     * @param outputMax – output range is <tt>[0, outputMax]</tt>, e.g. 1000 for per mille duty
+     */
+    explicit PidController(PidGains const gains, uint16_t const outputMax = 1000) :
+            gains(gains),
+            outputMax(outputMax) {}
+
+    PidGains const &getGains() const {
+        return gains;
+    }
+
+    void setGains(PidGains const gains) {
+        PidController::gains = gains;
+    }
+
+    uint16_t getOutputMax() const {
+        return outputMax;
+    }
+
+    /**
+     * <br/>
+     * Forgets the integral and the last measurement, call after the loop was open (e.g. autotune, sensor failure).
+     */
+    void reset() {
+        integralQ8 = 0;
+        hasLastMeasurement = false;
+    }
+
+    /**
+     * @param setPoint – wanted value
+     * @param measurement – current value, same unit as <tt>setPoint</tt>
+     * @return output in <tt>[0, outputMax]</tt>
+     */
+    uint16_t compute(int16_t const setPoint, int16_t const measurement) {
+        int32_t const maxQ8 = static_cast<int32_t>(outputMax) << 8;
+        /* bounded so that every Q8 term fits 32 bits */
+        int32_t error = PidController::clamp(static_cast<int32_t>(setPoint) - measurement, -16383, 16383);
+
+        int32_t proportionalQ8 = static_cast<int32_t>(gains.kp) * error;
+        int32_t derivativeQ8 = hasLastMeasurement
+                               ? static_cast<int32_t>(gains.kd) *
+                                 PidController::clamp(static_cast<int32_t>(measurement) - lastMeasurement, -16383, 16383)
+                               : 0;
+        lastMeasurement = measurement;
+        hasLastMeasurement = true;
+
+        /* conditional integration, only while it moves the output back into range */
+        int32_t unclampedQ8 = proportionalQ8 + integralQ8 - derivativeQ8;
+        int32_t integralStepQ8 = static_cast<int32_t>(gains.ki) * error;
+        if (!(unclampedQ8 >= maxQ8 && integralStepQ8 > 0) && !(unclampedQ8 <= 0 && integralStepQ8 < 0)) {
+            integralQ8 = PidController::clamp(integralQ8 + integralStepQ8, 0, maxQ8);
+        }
+
+        int32_t outputQ8 = PidController::clamp(proportionalQ8 + integralQ8 - derivativeQ8, 0, maxQ8);
+        return static_cast<uint16_t>((outputQ8 + 128) >> 8);
+    }
+};
+
+#endif
@@ -0,0 +1,156 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_COMMON_RELAY_AUTOTUNER_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_RELAY_AUTOTUNER_H_
+#pragma once
+
+#include <stdint.h>
+#include "PidController.h"
+
+/**
+ * <br/>
+ * Concrete class, Åström-Hägglund relay autotune, integer only.<br/>
+ * The relay switches the full output around the set point (with hysteresis), the loop settles into a limit cycle.
+ * From its period <tt>Tu</tt> and amplitude <tt>a</tt> the ultimate gain is <tt>Ku = 4·d / (π·a)</tt>,
+ * <tt>d</tt> being half the output swing, and the gains follow the classic Ziegler–Nichols PID rule:
+ * <tt>Kp = 0.6·Ku, Ti = Tu / 2, Td = Tu / 8</tt>.<br/>
+ * The start-up and the first full cycle are dropped (transient), the next <tt>cycles</tt> are averaged.
+ */
+class RelayAutotuner {
+
+private:
+
+    int16_t setPoint;
+    int16_t hysteresis;
+    uint16_t outputMax;
+    uint8_t cycles;
+
+    bool isRelayOn = false;
+    bool hasStarted = false;
+    uint8_t cycleCount = 0;          // <- switch-off events seen
+    uint32_t lastSwitchOffMs = 0;
+    int16_t cycleMax = INT16_MIN;
+    int16_t cycleMin = INT16_MAX;
+    uint32_t periodSumMs = 0;
+    uint32_t amplitudeSum = 0;       // <- sum of peak-to-peak / 2
+
+public:
+
+    /**
+     * @param setPoint – value oscillated around
+     * @param hysteresis – relay switches at <tt>setPoint ± hysteresis</tt>, above the sensor noise
+     * @param outputMax – full output, same as the tuned <tt>PidController</tt>
+     * @param cycles – limit cycles averaged
+     */
+    RelayAutotuner(int16_t const setPoint, int16_t const hysteresis, uint16_t const outputMax = 1000, uint8_t const cycles = 3) :
+            setPoint(setPoint),
+            hysteresis(hysteresis),
+            outputMax(outputMax),
+            cycles(cycles == 0 ? 1 : cycles) {}
+
+    /**
+     * @param measurement – current value
+     * @param nowMs – current time
+     * @return relay output, <tt>true</tt> for full output; stays <tt>false</tt> once done
+     */
+    bool update(int16_t const measurement, uint32_t const nowMs) {
+        if (RelayAutotuner::isDone()) {
+            return false;
+        }
+
+        if (!hasStarted) {
+            hasStarted = true;
+            isRelayOn = measurement < setPoint;
+        }
+
+        if (measurement > cycleMax) cycleMax = measurement;
+        if (measurement < cycleMin) cycleMin = measurement;
+
+        if (!isRelayOn && measurement < setPoint - hysteresis) {
+            isRelayOn = true;
+        } else if (isRelayOn && measurement > setPoint + hysteresis) {
+            isRelayOn = false;
+            RelayAutotuner::onSwitchOff(nowMs);
+        }
+
+        return isRelayOn && !RelayAutotuner::isDone();
+    }
+
+    bool isDone() const {
+        return cycleCount >= cycles + 2;
+    }
+
+    uint32_t getPeriodMs() const {
+        return RelayAutotuner::isDone() ? periodSumMs / cycles : 0;
+    }
+
+    /**
+     * <br/>
+     * Half the peak-to-peak oscillation, input units.
+     */
+    uint16_t getAmplitude() const {
+        return RelayAutotuner::isDone() ? static_cast<uint16_t>(amplitudeSum / cycles) : 0;
+    }
+
+    /**
+     * <br/>
+     * Ziegler–Nichols gains in Q8 per sample. The tune fails when it is not done yet or a gain does not fit
+     * <tt>int16_t</tt>, e.g. a derivative for a sample much shorter than the limit cycle, then <tt>gains</tt> is unchanged.
+     *
+     * @param sampleMs – period the tuned <tt>PidController::compute</tt> is called with
+     * @param gains – receives the gains
+     * @return <tt>false</tt> if the tune failed
+     */
+    bool getGains(uint32_t const sampleMs, PidGains &gains) const {
+        uint16_t amplitude = RelayAutotuner::getAmplitude();
+        uint32_t periodMs = RelayAutotuner::getPeriodMs();
+        if (amplitude == 0 || periodMs == 0 || sampleMs == 0) {
+            return false;
+        }
+
+        /* Ku·256 = 4·(outputMax / 2)·256 / (π·a), π ≈ 355 / 113 */
+        uint32_t kuQ8 = static_cast<uint32_t>(outputMax) * 2u * 256u * 113u / (355u * amplitude);
+        uint32_t kp = kuQ8 * 6u / 10u;
+        if (kp == 0 || kp > INT16_MAX) {
+            return false;
+        }
+        uint32_t ki = RelayAutotuner::scale(kp, 2u * sampleMs, periodMs); // <- Kp · sample / Ti
+        uint32_t kd = RelayAutotuner::scale(kp, periodMs, 8u * sampleMs); // <- Kp · Td / sample
+        if (ki > INT16_MAX || kd > INT16_MAX) {
+            return false;
+        }
+
+        gains = PidGains{static_cast<int16_t>(kp), static_cast<int16_t>(ki), static_cast<int16_t>(kd)};
+        return true;
+    }
+
+private:
+
+    /**
+     * <br/>
+     * <tt>value · numerator / denominator</tt> for <tt>value ≤ 0xFFFF</tt> in 32 bits,
+     * the fraction loses at most 1/32768 of its precision, <tt>UINT32_MAX</tt> if it does not fit.
+     */
+    static uint32_t scale(uint32_t const value, uint32_t numerator, uint32_t denominator) {
+        while (numerator > 0xFFFFul) {
+            numerator >>= 1;
+            denominator >>= 1;
+        }
+        if (denominator == 0) {
+            return UINT32_MAX;
+        }
+        return value * numerator / denominator;
+    }
+
+    void onSwitchOff(uint32_t const nowMs) {
+        /* the start and the first full cycle are transient, the next cycles are measured */
+        if (cycleCount >= 2) {
+            periodSumMs += nowMs - lastSwitchOffMs;
+            amplitudeSum += static_cast<uint16_t>(cycleMax - cycleMin) / 2u;
+        }
+        ++cycleCount;
+        lastSwitchOffMs = nowMs;
+        cycleMax = INT16_MIN;
+        cycleMin = INT16_MAX;
+    }
+};
+
+#endif
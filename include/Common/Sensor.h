@@ -2,12 +2,23 @@
 #define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_SENSOR_H_
 #pragma once
 
+#ifdef __TEST_MODE__
+
+#include <stdint.h>
+#include "../../test/_Mocks/MockCommon.h"
+
+#endif
+
 #include "Abstract/IForwarder.h"
+#include "Enums/ReadingQuality.h"
 
 /**
  * <br/>
  * Concrete class.<br/>
- * Call <tt>setReading(T const reading)</tt> to update sensor reading.
+ * Call <tt>setReading(T const reading)</tt> to update sensor reading.<br/>
+ * Call <tt>setError()</tt> when the hardware read fails, the last reading is kept but marked as <tt>ReadingQuality::Error</tt>.<br/>
+ * Every reading is time stamped, with <tt>maxAgeMs</tt> greater than zero a reading older than <tt>maxAgeMs</tt>
+ * is reported as <tt>ReadingQuality::Stale</tt>. Until the first reading the sensor is <tt>Stale</tt>.
  *
  * @tparam T – sensor data type
  */
@@ -18,6 +29,9 @@ private:
 
     const IForwarder<T> *forwarder;
     T reading;
+    uint32_t readingMs = 0;
+    uint32_t maxAgeMs;
+    ReadingQuality quality = ReadingQuality::Stale;
 
     void forwardReading() const {
         forwarder->forward(reading);
@@ -27,16 +41,20 @@ public:
 
     Sensor(
             IForwarder<T> const *forwarder,
-            T initialReading
+            T initialReading,
+            uint32_t maxAgeMs = 0
     ) :
             forwarder(forwarder),
-            reading(initialReading) {}
+            reading(initialReading),
+            maxAgeMs(maxAgeMs) {}
 
     explicit Sensor(
-            T initialReading
+            T initialReading,
+            uint32_t maxAgeMs = 0
     ) :
             forwarder(nullptr),
-            reading(initialReading) {}
+            reading(initialReading),
+            maxAgeMs(maxAgeMs) {}
 
     ~Sensor() = default;
 
@@ -46,14 +64,59 @@ public:
 
     void setReading(T const reading) {
         Sensor::reading = reading;
+        Sensor::readingMs = millis();
+        Sensor::quality = ReadingQuality::Ok;
         if (forwarder != nullptr) {
             Sensor::forwardReading();
         }
     }
 
+    /**
+     * <br/>
+     * Marks the last reading as failed, the reading itself is not changed and not forwarded,
+     * the quality is forwarded once when it turns to <tt>Error</tt>.
+     */
+    void setError() {
+        if (quality == ReadingQuality::Error) {
+            return;
+        }
+        Sensor::quality = ReadingQuality::Error;
+        if (forwarder != nullptr) {
+            forwarder->forwardQuality(ReadingQuality::Error);
+        }
+    }
+
     bool isReading(T const value) const {
         return reading == value;
     }
+
+    /* § Section: Reading Quality */
+
+    uint32_t getReadingMs() const {
+        return readingMs;
+    }
+
+    uint32_t getMaxAgeMs() const {
+        return maxAgeMs;
+    }
+
+    /**
+     * @param maxAgeMs – reading older than <tt>maxAgeMs</tt> is stale, <tt>0</tt> disables the check
+     */
+    void setMaxAgeMs(uint32_t const maxAgeMs) {
+        Sensor::maxAgeMs = maxAgeMs;
+    }
+
+    ReadingQuality getQuality() const {
+        if (quality == ReadingQuality::Ok && maxAgeMs > 0 && millis() - readingMs > maxAgeMs) {
+            return ReadingQuality::Stale;
+        }
+        return quality;
+    }
+
+    bool isFresh() const {
+        return Sensor::getQuality() == ReadingQuality::Ok;
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
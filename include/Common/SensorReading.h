@@ -0,0 +1,21 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_COMMON_SENSOR_READING_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_SENSOR_READING_H_
+#pragma once
+
+/**
+ * <br/>
+ * Reading type of a sensor type, <tt>SensorReading<Sensor<Centi>>::type</tt> is <tt>Centi</tt>.<br/>
+ * A <tt>std::declval</tt> stand in, AVR has no <tt><utility></tt>: <tt>sensor()</tt> is declared only,
+ * it appears in <tt>decltype</tt> and is never called.
+ *
+ * @tparam S – sensor type, provides <tt>getReading() const</tt>
+ */
+template<typename S>
+struct SensorReading {
+
+    static S const &sensor();
+
+    using type = decltype(sensor().getReading());
+};
+
+#endif
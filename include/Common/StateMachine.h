@@ -0,0 +1,144 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_COMMON_STATE_MACHINE_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_STATE_MACHINE_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * <br/>
+ * One row of a transition table: in <tt>state</tt>, on any of <tt>events</tt>, if <tt>guard</tt> holds,
+ * run <tt>action</tt> and go to <tt>next</tt>.<br/>
+ * Literal type, tables are <tt>static constexpr</tt> arrays.
+ *
+ * @tparam C – context type, owner of guards and actions
+ * @tparam S – state enum
+ */
+template<typename C, typename S>
+struct StateTransition {
+    S state;
+    uint8_t events;             // <- bit mask, see StateMachine::on()
+    bool (C::*guard)() const;   // <- nullptr always holds
+    void (C::*action)();        // <- nullptr does nothing
+    S next;
+};
+
+/**
+ * <br/>
+ * Concrete class, table driven finite state machine.<br/>
+ * Events are posted as bits and coalesced until <tt>dispatch</tt>, which takes the first row of the current state
+ * matching any pending event with a holding guard. At most one transition per dispatch,
+ * without pending events <tt>dispatch</tt> costs one comparison.
+ * \code
+ *     static constexpr StateTransition<Door, DoorState> transitions[] = {
+ *             {DoorState::Closed, Machine::on(DoorEvent::Push), &Door::isUnlocked, &Door::open, DoorState::Open},
+ *     };
+ * \endcode
+ *
+ * @tparam C – context type, owner of guards and actions
+ * @tparam S – state enum
+ * @tparam E – event enum, at most 8 events, values 0 .. 7
+ */
+template<typename C, typename S, typename E>
+class StateMachine {
+
+public:
+
+    static constexpr uint8_t noTransition = UINT8_MAX;
+
+private:
+
+    StateTransition<C, S> const *transitions;
+    uint8_t transitionCount;
+    S state;
+    uint8_t pendingEvents = 0;
+    uint8_t lastTransition = noTransition;
+
+public:
+
+    static constexpr uint8_t on(E const event) {
+        return static_cast<uint8_t>(1u << static_cast<uint8_t>(event));
+    }
+
+    template<typename... Es>
+    static constexpr uint8_t on(E const event, Es const... events) {
+        return static_cast<uint8_t>(on(event) | on(events...));
+    }
+
+    template<uint8_t N>
+    StateMachine(StateTransition<C, S> const (&transitions)[N], S const initialState) :
+            transitions(transitions),
+            transitionCount(N),
+            state(initialState) {}
+
+    S const &getState() const {
+        return state;
+    }
+
+    bool isInState(S const compareState) const {
+        return state == compareState;
+    }
+
+    /**
+     * <br/>
+     * Forced state change from outside the table (e.g. sleep, reset), pending events are dropped.
+     */
+    void setState(S const newState) {
+        state = newState;
+        pendingEvents = 0;
+    }
+
+    void post(E const event) {
+        pendingEvents |= on(event);
+    }
+
+    bool hasPendingEvents() const {
+        return pendingEvents != 0;
+    }
+
+    uint8_t getTransitionCount() const {
+        return transitionCount;
+    }
+
+    /**
+     * <br/>
+     * Index of the row taken by the last dispatch, <tt>noTransition</tt> if none matched.
+     */
+    uint8_t getLastTransition() const {
+        return lastTransition;
+    }
+
+    /**
+     * @param context – object the guards and actions are called on
+     * @return <tt>true</tt> if the state changed
+     */
+    bool dispatch(C &context) {
+        if (pendingEvents == 0) {
+            return false;
+        }
+
+        uint8_t events = pendingEvents;
+        pendingEvents = 0;
+        lastTransition = noTransition;
+
+        for (uint8_t index = 0; index < transitionCount; ++index) {
+            StateTransition<C, S> const &transition = transitions[index];
+            if (transition.state != state || !(transition.events & events)) {
+                continue;
+            }
+            if (transition.guard != nullptr && !(context.*transition.guard)()) {
+                continue;
+            }
+
+            lastTransition = index;
+            if (transition.action != nullptr) {
+                (context.*transition.action)();
+            }
+            bool isChanged = transition.next != state;
+            state = transition.next;
+            return isChanged;
+        }
+        return false;
+    }
+};
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_COMMON_TONE_ENVELOPE_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_COMMON_TONE_ENVELOPE_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * <br/>
+ * Frequency and volume sweep of a phase correct PWM tone, in timer register values.<br/>
+ * One tone period is <tt>2 × TOP</tt> timer ticks, the duty cycle <tt>compare / TOP</tt> is the volume,
+ * 50 % at full volume.<br/>
+ * <tt>start</tt> does the divisions, <tt>onPeriod</tt> is called from the timer interrupt once per tone period
+ * and only adds: once per millisecond of timer ticks TOP and volume move by a fixed step, in 16.16 fixed point.
+ * The sweep is linear in the period, not in the frequency.
+ * \code
+ *     ToneEnvelope envelope{F_CPU / 32};
+ *     envelope.start(2000, 4000, 255, 64, 150, true); // <- 150 ms chirp up, fading, repeated
+ *     ISR(TIMER2_OVF_vect) { if (envelope.onPeriod()) { OCR2A = envelope.getTop(); OCR2B = envelope.getCompare(); } }
+ * \endcode
+ */
+class ToneEnvelope {
+
+public:
+
+    static constexpr uint8_t minTop = 2;
+    static constexpr uint8_t maxTop = 255;
+
+private:
+
+    uint32_t timerHz;
+    uint16_t ticksPerMs;
+
+    int32_t topQ16 = 0;
+    int32_t topStepQ16 = 0;
+    int32_t volumeQ16 = 0;
+    int32_t volumeStepQ16 = 0;
+
+    uint8_t startTop = maxTop;
+    uint8_t endTop = maxTop;
+    uint8_t startVolume = 0;
+    uint8_t endVolume = 0;
+
+    uint16_t sweepMs = 0;
+    uint16_t elapsedMs = 0;
+    uint16_t elapsedTicks = 0;
+
+    bool repeating = false;
+    bool active = false;
+
+    void restart() {
+        topQ16 = static_cast<int32_t>(startTop) << 16;
+        volumeQ16 = static_cast<int32_t>(startVolume) << 16;
+        elapsedMs = 0;
+    }
+
+    void stepOneMs() {
+        if (elapsedMs < sweepMs) {
+            ++elapsedMs;
+            if (elapsedMs == sweepMs) {
+                /* land exactly, no accumulated rounding */
+                topQ16 = static_cast<int32_t>(endTop) << 16;
+                volumeQ16 = static_cast<int32_t>(endVolume) << 16;
+            } else {
+                topQ16 += topStepQ16;
+                volumeQ16 += volumeStepQ16;
+            }
+        } else if (repeating) {
+            ToneEnvelope::restart();
+        }
+    }
+
+public:
+
+    /**
+     * @param timerHz – timer clock after the prescaler, e.g. <tt>F_CPU / 32</tt>
+     */
+    explicit ToneEnvelope(uint32_t const timerHz) :
+            timerHz(timerHz),
+            ticksPerMs(static_cast<uint16_t>(timerHz < 1000 ? 1 : timerHz / 1000)) {}
+
+    /**
+     * <br/>
+     * TOP of the nearest period, limited to <tt>minTop .. maxTop</tt>.
+     */
+    uint8_t topFor(uint16_t const frequencyHz) const {
+        if (frequencyHz == 0) {
+            return maxTop;
+        }
+        uint32_t top = (timerHz + frequencyHz) / (2ul * frequencyHz);
+        return static_cast<uint8_t>(top < minTop ? minTop : (top > maxTop ? maxTop : top));
+    }
+
+    /**
+     * <br/>
+     * Not from the interrupt, with the timer interrupt disabled.
+     *
+     * @param sweepMs – 0 for a steady tone at <tt>startHz</tt> and <tt>startVolume</tt>
+     * @param repeating – start over after <tt>sweepMs</tt>, otherwise hold the end values
+     */
+    void start(
+            uint16_t const startHz,
+            uint16_t const endHz,
+            uint8_t const startVolume,
+            uint8_t const endVolume,
+            uint16_t const sweepMs,
+            bool const repeating
+    ) {
+        startTop = ToneEnvelope::topFor(startHz);
+        endTop = ToneEnvelope::topFor(endHz);
+        ToneEnvelope::startVolume = startVolume;
+        ToneEnvelope::endVolume = endVolume;
+        ToneEnvelope::sweepMs = sweepMs;
+        ToneEnvelope::repeating = repeating;
+        if (sweepMs > 0) {
+            topStepQ16 = (static_cast<int32_t>(endTop) - startTop) * 65536l / sweepMs; // <- no shift, may be negative
+            volumeStepQ16 = (static_cast<int32_t>(endVolume) - startVolume) * 65536l / sweepMs;
+        } else {
+            topStepQ16 = 0;
+            volumeStepQ16 = 0;
+        }
+        elapsedTicks = 0;
+        ToneEnvelope::restart();
+        active = true;
+    }
+
+    void stop() {
+        active = false;
+    }
+
+    bool isActive() const {
+        return active;
+    }
+
+    /**
+     * <br/>
+     * Called from the timer interrupt at the end of every tone period.
+     *
+     * @return <tt>true</tt> if TOP or compare changed
+     */
+    bool onPeriod() {
+        if (!active || sweepMs == 0) {
+            return false;
+        }
+        elapsedTicks = static_cast<uint16_t>(elapsedTicks + 2u * ToneEnvelope::getTop());
+        bool isChanged = false;
+        while (elapsedTicks >= ticksPerMs) {
+            elapsedTicks = static_cast<uint16_t>(elapsedTicks - ticksPerMs);
+            ToneEnvelope::stepOneMs();
+            isChanged = true;
+        }
+        return isChanged;
+    }
+
+    uint8_t getTop() const {
+        return static_cast<uint8_t>(topQ16 >> 16);
+    }
+
+    uint8_t getVolume() const {
+        return static_cast<uint8_t>(volumeQ16 >> 16);
+    }
+
+    /**
+     * <br/>
+     * Compare value of the current volume, <tt>TOP / 2</tt> at full volume.
+     */
+    uint8_t getCompare() const {
+        return static_cast<uint8_t>((static_cast<uint16_t>(ToneEnvelope::getTop()) * ToneEnvelope::getVolume()) >> 9);
+    }
+};
+
+#endif
@@ -13,6 +13,28 @@ enum class AlarmCode : uint8_t {
     AtoReservoirLow,
     AtoHighLevel,
     AtoLowLevel,
+    /* further ATO stations, see AtoAlarmCodes::forStation<index>(), the reservoir code is shared */
+    Ato2TopOffFailed,
+    Ato2HighLevel,
+    Ato2LowLevel,
+    Ato3TopOffFailed,
+    Ato3HighLevel,
+    Ato3LowLevel,
+    Ato4TopOffFailed,
+    Ato4HighLevel,
+    Ato4LowLevel,
+    /* ambient inputs gone stale or failed, in AmbientInput order */
+    AmbientHumiditySensorFault,
+    AmbientTemperatureSensorFault,
+    SystemTemperatureSensorFault,
+    WaterTemperatureSensorFault,
 };
 
+#ifndef ALARM_CODE_COUNT
+#define ALARM_CODE_COUNT 23 // <- AlarmCode::NoAlarm .. AlarmCode::WaterTemperatureSensorFault
+#endif
+
+static_assert(static_cast<uint8_t>(AlarmCode::WaterTemperatureSensorFault) < ALARM_CODE_COUNT, "ALARM_CODE_COUNT must cover every AlarmCode");
+static_assert(ALARM_CODE_COUNT <= 32, "alarm codes are kept in 32 bit masks");
+
 #endif
@@ -0,0 +1,15 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_ALARM_EVENT_TYPE_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_ALARM_EVENT_TYPE_H_
+#pragma once
+
+#include <stdint.h>
+
+enum class AlarmEventType : uint8_t {
+    Raised,         // 0
+    Cleared,        // 1
+    Acknowledged,   // 2
+    Escalated,      // 3
+    Removed,        // 4
+};
+
+#endif
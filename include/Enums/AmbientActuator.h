@@ -0,0 +1,15 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_AMBIENT_ACTUATOR_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_AMBIENT_ACTUATOR_H_
+#pragma once
+
+#include <stdint.h>
+
+enum class AmbientActuator : uint8_t {
+    AmbientFan,  // 0
+    SystemFan,   // 1
+    WaterCooler, // 2
+    WaterHeater, // 3
+    None,        // 4 <- alarm only rule, keep last
+};
+
+#endif
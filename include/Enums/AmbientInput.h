@@ -0,0 +1,14 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_AMBIENT_INPUT_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_AMBIENT_INPUT_H_
+#pragma once
+
+#include <stdint.h>
+
+enum class AmbientInput : uint8_t {
+    AmbientHumidity,    // 0
+    AmbientTemperature, // 1
+    SystemTemperature,  // 2
+    WaterTemperature,   // 3
+};
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_ATO_DISPENSE_END_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_ATO_DISPENSE_END_H_
+#pragma once
+
+#include <stdint.h>
+
+enum class AtoDispenseEnd : uint8_t {
+    NormalLevel,    // 0
+    HighLevel,      // 1
+    LowLevel,       // 2
+    Timeout,        // 3
+    Sleep,          // 4
+};
+
+#endif
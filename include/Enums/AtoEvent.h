@@ -0,0 +1,14 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_ATO_EVENT_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_ATO_EVENT_H_
+#pragma once
+
+#include <stdint.h>
+
+enum class AtoEvent : uint8_t {
+    LevelChanged,       // 0
+    StateEntered,       // 1
+    TimerElapsed,       // 2
+    PowerAvailable,     // 3
+};
+
+#endif
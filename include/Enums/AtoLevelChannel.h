@@ -0,0 +1,14 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_ATO_LEVEL_CHANNEL_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_ATO_LEVEL_CHANNEL_H_
+#pragma once
+
+#include <stdint.h>
+
+enum class AtoLevelChannel : uint8_t {
+    Normal,     // 0
+    High,       // 1
+    Low,        // 2
+    Reservoir,  // 3
+};
+
+#endif
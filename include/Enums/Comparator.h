@@ -0,0 +1,12 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_COMPARATOR_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_COMPARATOR_H_
+#pragma once
+
+#include <stdint.h>
+
+enum class Comparator : uint8_t {
+    Above, // <- active at or above the threshold, e.g. fan, cooler
+    Below, // <- active below the threshold, e.g. heater
+};
+
+#endif
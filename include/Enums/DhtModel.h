@@ -0,0 +1,16 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_DHT_MODEL_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_DHT_MODEL_H_
+#pragma once
+
+#include <stdint.h>
+
+enum class DhtModel : uint8_t {
+    Dht11 = 11,
+    Dht12 = 12,
+    Dht21 = 21,
+    Dht22 = 22,
+    Am2301 = 21,
+    Am2302 = 22,
+};
+
+#endif
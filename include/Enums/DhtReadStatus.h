@@ -0,0 +1,15 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_DHT_READ_STATUS_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_DHT_READ_STATUS_H_
+#pragma once
+
+#include <stdint.h>
+
+enum class DhtReadStatus : uint8_t {
+    Ok,               // 0
+    NoResponse,       // 1 <- no edge captured
+    Incomplete,       // 2 <- frame shorter than 40 bits
+    BadTiming,        // 3 <- edge interval out of protocol range
+    ChecksumMismatch, // 4
+};
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_READING_QUALITY_H_
+#define _AQUARIUM_CONTROLLER_INCLUDE_ENUMS_READING_QUALITY_H_
+#pragma once
+
+#include <stdint.h>
+
+enum class ReadingQuality : uint8_t {
+    Ok,     // <- reading is fresh
+    Stale,  // <- no reading yet, or reading older than the sensor max age
+    Error,  // <- last read attempt failed
+};
+
+#endif
@@ -29,10 +29,12 @@
 #include "../examples/Arduino/AtoStation/ArduinoAtoLevelSensor.h"
 #include "../examples/Arduino/Common/ArduinoSleepPushButton.h"
 #include "../examples/Arduino/Common/ArduinoBuzzer.h"
+#include "../examples/Arduino/Common/ArduinoPatternSequencer.h"
 
 #include <Abstract/AbstractRunnable.h>
 
 #include <AtoStation/AtoSettings.h>
+#include <AlarmStation/AlarmStation.h>
 #include <AtoStation/AtoStation.h>
 #include <AtoStation/HighLevelSensorConnection.h>
 #include <AtoStation/NormalLevelSensorConnection.h>
@@ -107,9 +109,14 @@ ArduinoAtoLevelSensor atoReservoirLowLiquidLevelSensor =
 
 /**
  * Create signalling led controller.
+ * All leds are played by one sequencer, they must be on the same port.
  * Remove/Comment not implemented hardware.
  */
-ArduinoAtoLedController atoLedController(atoStation, McuPin::RedLed, McuPin::YellowLed, McuPin::GreenLed);
+ArduinoPatternSequencer ledSequencer{};
+uint8_t const redLedChannel = ledSequencer.attachPin(McuPin::RedLed);
+uint8_t const yellowLedChannel = ledSequencer.attachPin(McuPin::YellowLed);
+uint8_t const greenLedChannel = ledSequencer.attachPin(McuPin::GreenLed);
+ArduinoAtoLedController atoLedController(atoStation, ledSequencer, redLedChannel, yellowLedChannel, greenLedChannel);
 
 /**
  * Create alarm station.
@@ -240,6 +240,90 @@ static void shouldGetFalseOnCheckIfAcknowledgedForAlarmNotInTheArray() {
     std::cout << "ok -> shouldGetFalseOnCheckIfAcknowledgedForAlarmNotInTheArray" << "\n";
 }
 
+static void shouldFindHighestSeverityPendingAlarm() {
+
+    /* given */
+    AlarmArray<10> alarmArray{};
+    alarmArray.add(AlarmCode::AtoLowLevel, AlarmSeverity::Minor);
+    alarmArray.add(AlarmCode::AtoReservoirLow, AlarmSeverity::Major);
+    alarmArray.add(AlarmCode::AtoTopOffFailed, AlarmSeverity::Major);
+    alarmArray.add(AlarmCode::WaterMaxTemperatureReached, AlarmSeverity::Critical);
+
+    /* when & then */
+    assert(alarmArray.getHighestPendingAlarm() == AlarmCode::WaterMaxTemperatureReached);
+    assert(alarmArray.getHighestPendingSeverity() == AlarmSeverity::Critical);
+
+    /* when, critical acknowledged, the lowest major code wins */
+    alarmArray.acknowledge(AlarmCode::WaterMaxTemperatureReached);
+
+    /* then */
+    assert(alarmArray.getHighestPendingAlarm() == AlarmCode::AtoTopOffFailed);
+    assert(alarmArray.getHighestPendingSeverity() == AlarmSeverity::Major);
+
+    /* when */
+    alarmArray.remove(AlarmCode::AtoTopOffFailed);
+    alarmArray.acknowledge(AlarmCode::AtoReservoirLow);
+
+    /* then */
+    assert(alarmArray.getHighestPendingAlarm() == AlarmCode::AtoLowLevel);
+    assert(alarmArray.getHighestPendingSeverity() == AlarmSeverity::Minor);
+
+    /* when */
+    alarmArray.acknowledge(AlarmCode::AtoLowLevel);
+
+    /* then */
+    assert(!alarmArray.hasPending());
+    assert(alarmArray.getHighestPendingAlarm() == AlarmCode::NoAlarm);
+    assert(alarmArray.getHighestPendingSeverity() == AlarmSeverity::NoSeverity);
+
+    std::cout << "ok -> shouldFindHighestSeverityPendingAlarm" << "\n";
+}
+
+static void shouldCountBySeverityAndPending() {
+
+    /* given */
+    AlarmArray<10> alarmArray{};
+    alarmArray.add(AlarmCode::AtoLowLevel, AlarmSeverity::Minor);
+    alarmArray.add(AlarmCode::AtoHighLevel, AlarmSeverity::Major);
+    alarmArray.add(AlarmCode::AtoReservoirLow, AlarmSeverity::Major);
+    alarmArray.add(AlarmCode::SystemMaxTemperatureReached, AlarmSeverity::NoSeverity);
+
+    /* when */
+    alarmArray.acknowledge(AlarmCode::AtoHighLevel);
+    alarmArray.add(AlarmCode::AtoLowLevel, AlarmSeverity::Critical); // <- severity changes in place
+
+    /* then */
+    assert(alarmArray.size() == 4);
+    assert(alarmArray.countPending() == 3);
+    assert(alarmArray.countWithSeverity(AlarmSeverity::Major) == 2);
+    assert(alarmArray.countWithSeverity(AlarmSeverity::Critical) == 1);
+    assert(alarmArray.countWithSeverity(AlarmSeverity::Minor) == 0);
+    assert(alarmArray.countWithSeverity(AlarmSeverity::NoSeverity) == 1);
+    assert(alarmArray.get(AlarmCode::AtoLowLevel).getSeverity() == AlarmSeverity::Critical);
+    assert(alarmArray.get(AlarmCode::AtoHighLevel).isAcknowledged());
+
+    std::cout << "ok -> shouldCountBySeverityAndPending" << "\n";
+}
+
+static void shouldKeepNotificationTimestampsApart() {
+
+    /* given */
+    AlarmArray<10> alarmArray{};
+    alarmArray.add(AlarmCode::AtoLowLevel, AlarmSeverity::Minor);
+
+    /* when */
+    alarmArray.setLastNotificationMs(AlarmCode::AtoLowLevel, 123456);
+
+    /* then */
+    assert(alarmArray.getLastNotificationMs(AlarmCode::AtoLowLevel) == 123456);
+    assert(alarmArray.get(AlarmCode::AtoLowLevel).getLastNotificationMs() == 123456);
+    size_t packedBytes = 4 * sizeof(uint32_t) + 10 * sizeof(uint32_t) + sizeof(uint16_t); // <- + modification count
+    size_t alignment = alignof(uint32_t);
+    assert(sizeof(AlarmArray<10>) == (packedBytes + alignment - 1) / alignment * alignment);
+
+    std::cout << "ok -> shouldKeepNotificationTimestampsApart" << "\n";
+}
+
 int main(int argc, char *argv[]) {
 
     std::cout << "\n"
@@ -268,6 +352,10 @@ int main(int argc, char *argv[]) {
         shouldNotAcknowledgeAlarmByAlarmCodeNotInTheArray();
 
         shouldGetFalseOnCheckIfAcknowledgedForAlarmNotInTheArray();
+
+        shouldFindHighestSeverityPendingAlarm();
+        shouldCountBySeverityAndPending();
+        shouldKeepNotificationTimestampsApart();
     }
 
     auto finish = std::chrono::high_resolution_clock::now();
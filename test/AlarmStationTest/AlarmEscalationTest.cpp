@@ -0,0 +1,183 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <iostream>
+#include <chrono>
+
+#include "../_Mocks/MockCommon.h"
+
+#include <Abstract/AbstractRunnable.h>
+
+#include "Enums/AlarmCode.h"
+#include "Enums/AlarmSeverity.h"
+#include "AlarmStation/AlarmEscalation.h"
+#include "AlarmStation/AlarmStation.h"
+#include "AlarmStation/AlarmNotifyConfiguration.h"
+
+#include "../_Mocks/MockBuzzer.h"
+
+static LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> alarmNotifyConfigurations{};
+
+static AlarmCode const alarmCode = AlarmCode::AtoReservoirLow;
+
+static uint32_t const minuteMs = 60ul * 1000ul;
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static void loop(uint32_t forwardMs) {
+    for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+        loop();
+    }
+}
+
+/**
+ * <br/>
+ * Severity of a pending alarm, <tt>NoSeverity</tt> if not pending.
+ */
+template<typename S>
+static AlarmSeverity pendingSeverity(BasicAlarmStation<S> &alarmStation) {
+    AlarmSeverity pendingSeverity = AlarmSeverity::NoSeverity;
+    alarmStation.alarmList.forEachPending([&pendingSeverity](AlarmCode const code, AlarmSeverity const severity, uint32_t const) {
+        if (code == alarmCode) {
+            pendingSeverity = severity;
+        }
+    });
+    return pendingSeverity;
+}
+
+static void shouldChainRulesFromRaise() {
+    /* given */
+    AlarmEscalation alarmEscalation{};
+    assert(alarmEscalation.setRule(AlarmSeverity::Minor, AlarmSeverity::Major, 30));
+    assert(alarmEscalation.setRule(AlarmSeverity::Major, AlarmSeverity::Critical, 120));
+    assert(!alarmEscalation.setRule(AlarmSeverity::Major, AlarmSeverity::Minor, 10));
+    assert(!alarmEscalation.setRule(AlarmSeverity::Critical, AlarmSeverity::Critical, 10));
+
+    /* when */
+    alarmEscalation.markRaised(alarmCode, 1000);
+
+    /* then */
+    assert(alarmEscalation.escalate(alarmCode, AlarmSeverity::Minor, 1000 + 30 * minuteMs - 1) == AlarmSeverity::Minor);
+    assert(alarmEscalation.escalate(alarmCode, AlarmSeverity::Minor, 1000 + 30 * minuteMs) == AlarmSeverity::Major);
+    assert(alarmEscalation.escalate(alarmCode, AlarmSeverity::Minor, 1000 + 120 * minuteMs) == AlarmSeverity::Critical);
+    assert(alarmEscalation.escalate(alarmCode, AlarmSeverity::Major, 1000 + 60 * minuteMs) == AlarmSeverity::Major);
+
+    /* when, deadlines */
+    alarmEscalation.clearDeadline();
+    alarmEscalation.offerDeadline(alarmCode, AlarmSeverity::Major);
+    alarmEscalation.offerDeadline(AlarmCode::AtoHighLevel, AlarmSeverity::Critical); // <- no rule
+
+    /* then */
+    assert(!alarmEscalation.isDue(1000 + 120 * minuteMs - 1));
+    assert(alarmEscalation.isDue(1000 + 120 * minuteMs));
+
+    std::cout << "ok -> shouldChainRulesFromRaise\n";
+}
+
+template<typename S>
+static void shouldEscalateUnacknowledgedAlarm() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    BasicAlarmStation<S> alarmStation{mockBuzzer, alarmNotifyConfigurations};
+    AlarmEscalation alarmEscalation{};
+    alarmEscalation.setRule(AlarmSeverity::Minor, AlarmSeverity::Major, 1);
+    alarmEscalation.setRule(AlarmSeverity::Major, AlarmSeverity::Critical, 2);
+    alarmStation.attachEscalation(&alarmEscalation);
+
+    /* when */
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Minor);
+    loop(10);
+    uint16_t modificationCount = alarmStation.alarmList.getModificationCount();
+    loop(minuteMs - 11);
+
+    /* then */
+    assert(pendingSeverity(alarmStation) == AlarmSeverity::Minor);
+    assert(alarmStation.alarmList.getModificationCount() == modificationCount);
+    assert(!mockBuzzer.isBusy());
+
+    /* when */
+    loop();
+    loop();
+
+    /* then, notified at once with the new severity */
+    assert(pendingSeverity(alarmStation) == AlarmSeverity::Major);
+    assert(mockBuzzer.isInState(Switched::On));
+
+    /* when */
+    loop(minuteMs);
+
+    /* then */
+    assert(pendingSeverity(alarmStation) == AlarmSeverity::Critical);
+    assert(alarmStation.alarmList.getModificationCount() == modificationCount + 2);
+
+    std::cout << "ok -> shouldEscalateUnacknowledgedAlarm\n";
+}
+
+static void shouldRestartEscalationWhenRaisedAgain() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    FixedAlarmStation alarmStation{mockBuzzer, alarmNotifyConfigurations};
+    AlarmEscalation alarmEscalation{};
+    alarmEscalation.setRule(AlarmSeverity::Minor, AlarmSeverity::Major, 1);
+    alarmStation.attachEscalation(&alarmEscalation);
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Minor);
+    loop(50ul * 1000ul);
+
+    /* when, acknowledged before the escalation */
+    alarmStation.clearAlarm(alarmCode);
+    loop(20ul * 1000ul);
+
+    /* then */
+    assert(alarmStation.alarmList.isAcknowledged(alarmCode));
+    assert(alarmStation.alarmList.get(alarmCode).getSeverity() == AlarmSeverity::Minor);
+
+    /* when, raised again, counts from now */
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Minor);
+    loop(minuteMs - 10);
+
+    /* then */
+    assert(pendingSeverity(alarmStation) == AlarmSeverity::Minor);
+
+    /* when */
+    loop(20);
+
+    /* then */
+    assert(pendingSeverity(alarmStation) == AlarmSeverity::Major);
+
+    std::cout << "ok -> shouldRestartEscalationWhenRaisedAgain\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldChainRulesFromRaise();
+        shouldEscalateUnacknowledgedAlarm<AlarmList>();
+        shouldEscalateUnacknowledgedAlarm<AlarmArray<ALARM_CODE_COUNT>>();
+        shouldRestartEscalationWhenRaisedAgain();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
@@ -0,0 +1,283 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <iostream>
+#include <chrono>
+
+#include "../_Mocks/MockCommon.h"
+
+#include <Abstract/AbstractRunnable.h>
+
+#include "Enums/AlarmCode.h"
+#include "Enums/AlarmSeverity.h"
+#include "AlarmStation/AlarmFlapFilter.h"
+#include "AlarmStation/AlarmStation.h"
+#include "AlarmStation/AlarmNotifyConfiguration.h"
+
+#include "../_Mocks/MockBuzzer.h"
+
+static LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> alarmNotifyConfigurations{};
+
+static AlarmCode const alarmCode = AlarmCode::AtoHighLevel;
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static void shouldApplyFirstReportAtOnceAndHoldTheNext() {
+    /* given */
+    AlarmFlapFilter flapFilter{1000, 16, 4, 5, 6};
+    uint8_t appliedCount = 0;
+    bool isRaised = true;
+    auto action = [&appliedCount, &isRaised](AlarmCode const, bool const raised, AlarmSeverity const) {
+        ++appliedCount;
+        isRaised = raised;
+    };
+
+    /* when & then */
+    assert(flapFilter.report(alarmCode, true, AlarmSeverity::Major, 0));
+    assert(!flapFilter.report(alarmCode, false, AlarmSeverity::NoSeverity, 1000));
+    assert(flapFilter.isDeferred(alarmCode));
+
+    /* when, hold not over */
+    flapFilter.forEachDue(4999, action);
+
+    /* then */
+    assert(appliedCount == 0);
+
+    /* when */
+    flapFilter.forEachDue(5000, action);
+
+    /* then */
+    assert(appliedCount == 1);
+    assert(!isRaised);
+    assert(!flapFilter.hasDeferred());
+
+    std::cout << "ok -> shouldApplyFirstReportAtOnceAndHoldTheNext\n";
+}
+
+static void shouldCancelDeferredChangeThatReturns() {
+    /* given */
+    AlarmFlapFilter flapFilter{1000, 16, 4, 5, 6};
+    uint8_t appliedCount = 0;
+    assert(flapFilter.report(alarmCode, true, AlarmSeverity::Major, 0));
+
+    /* when, a short glitch */
+    bool isCleared = flapFilter.report(alarmCode, false, AlarmSeverity::NoSeverity, 1000);
+    bool isRaised = flapFilter.report(alarmCode, true, AlarmSeverity::Major, 2000);
+    flapFilter.forEachDue(60000, [&appliedCount](AlarmCode const, bool const, AlarmSeverity const) {
+        ++appliedCount;
+    });
+
+    /* then */
+    assert(!isCleared);
+    assert(!isRaised);
+    assert(!flapFilter.hasDeferred());
+    assert(appliedCount == 0);
+
+    std::cout << "ok -> shouldCancelDeferredChangeThatReturns\n";
+}
+
+static void shouldBackOffExponentiallyWhileFlapping() {
+    /* given */
+    AlarmFlapFilter flapFilter{1000, 16, 4, 5, 6};
+    uint16_t appliedCount = 0;
+    auto action = [&appliedCount](AlarmCode const, bool const, AlarmSeverity const) {
+        ++appliedCount;
+    };
+
+    /* when, toggling every second for an hour */
+    bool isRaised = false;
+    uint32_t nowMs = 0;
+    for (; nowMs < 3600ul * 1000ul; nowMs += 1000) {
+        isRaised = !isRaised;
+        appliedCount += flapFilter.report(alarmCode, isRaised, AlarmSeverity::Minor, nowMs) ? 1 : 0;
+        flapFilter.forEachDue(nowMs, action);
+    }
+
+    /* then, 5 + 10 + 20 + 40 + 80 + 160 s, then every 320 s */
+    assert(flapFilter.getHoldSlots(alarmCode) == 5u << 6);
+    assert(appliedCount <= 7 + 3600 / 320);
+
+    /* when, quiet again */
+    for (uint32_t quietMs = 0; quietMs <= 2 * 320ul * 1000ul; quietMs += 1000) {
+        flapFilter.forEachDue(nowMs + quietMs, action);
+    }
+    nowMs += 2 * 320ul * 1000ul;
+    flapFilter.report(alarmCode, !isRaised, AlarmSeverity::Minor, nowMs);
+
+    /* then */
+    assert(!flapFilter.hasDeferred());
+    assert(flapFilter.getHoldSlots(alarmCode) == 5);
+
+    std::cout << "ok -> shouldBackOffExponentiallyWhileFlapping\n";
+}
+
+static void shouldForgetOldChangesAfterSixteenBitsOfSlots() {
+    /* given, flapping at the start, the last change applied in slot 5 */
+    AlarmFlapFilter flapFilter{1000, 16, 4, 5, 6};
+    auto action = [](AlarmCode const, bool const, AlarmSeverity const) {};
+    flapFilter.report(alarmCode, true, AlarmSeverity::Critical, 0);
+    flapFilter.report(alarmCode, false, AlarmSeverity::NoSeverity, 1000);
+    flapFilter.report(alarmCode, true, AlarmSeverity::Critical, 2000);
+    flapFilter.report(alarmCode, false, AlarmSeverity::NoSeverity, 3000);
+    flapFilter.forEachDue(5000, action);
+    assert(!flapFilter.hasDeferred());
+    assert(flapFilter.getHoldSlots(alarmCode) == 10);
+
+    /* when, quiet for 65536 slots, the raise lands in slot 6 for 16 bits */
+    uint32_t nowMs = (65536ul + 6) * 1000ul;
+    flapFilter.forEachDue(nowMs, action);
+    bool isApplied = flapFilter.report(alarmCode, true, AlarmSeverity::Critical, nowMs);
+
+    /* then */
+    assert(isApplied);
+    assert(!flapFilter.isDeferred(alarmCode));
+    assert(flapFilter.getHoldSlots(alarmCode) == 5);
+
+    std::cout << "ok -> shouldForgetOldChangesAfterSixteenBitsOfSlots\n";
+}
+
+static void shouldKeepHoldAcrossMillisRollover() {
+    /* given */
+    AlarmFlapFilter flapFilter{1000, 16, 4, 5, 6};
+    uint8_t appliedCount = 0;
+    auto action = [&appliedCount](AlarmCode const, bool const, AlarmSeverity const) {
+        ++appliedCount;
+    };
+    uint32_t nowMs = UINT32_MAX - 500;
+    assert(flapFilter.report(alarmCode, true, AlarmSeverity::Major, nowMs));
+
+    /* when, cleared right after millis() rolled over */
+    nowMs += 1000;
+    bool isApplied = flapFilter.report(alarmCode, false, AlarmSeverity::NoSeverity, nowMs);
+
+    /* then */
+    assert(!isApplied);
+    assert(flapFilter.isDeferred(alarmCode));
+
+    /* when */
+    flapFilter.forEachDue(nowMs + 3000, action);
+
+    /* then */
+    assert(appliedCount == 0);
+
+    /* when */
+    flapFilter.forEachDue(nowMs + 4000, action);
+
+    /* then */
+    assert(appliedCount == 1);
+
+    std::cout << "ok -> shouldKeepHoldAcrossMillisRollover\n";
+}
+
+static void shouldRemoveFilteredAlarmAtOnce() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    FixedAlarmStation alarmStation{mockBuzzer, alarmNotifyConfigurations};
+    AlarmFlapFilter flapFilter{};
+    alarmStation.attachFlapFilter(&flapFilter);
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Major);
+    alarmStation.clearAlarm(alarmCode);
+    assert(flapFilter.isDeferred(alarmCode));
+    assert(!alarmStation.alarmList.isAcknowledged(alarmCode));
+
+    /* when */
+    alarmStation.removeAlarm(alarmCode);
+
+    /* then */
+    assert(!alarmStation.alarmList.contains(alarmCode));
+    assert(!flapFilter.hasDeferred());
+
+    /* when, forgotten, applies at once */
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Major);
+
+    /* then */
+    assert(alarmStation.alarmList.contains(alarmCode));
+
+    std::cout << "ok -> shouldRemoveFilteredAlarmAtOnce\n";
+}
+
+/**
+ * <br/>
+ * Raises and clears the alarm every 300 ms for 10 minutes, returns the storage modifications.
+ */
+static uint16_t playNoisySensor(AlarmFlapFilter *const pFlapFilter, uint16_t &switchedOnCount) {
+    MockBuzzer mockBuzzer{1000};
+    FixedAlarmStation alarmStation{mockBuzzer, alarmNotifyConfigurations};
+    alarmStation.attachFlapFilter(pFlapFilter);
+    Switched buzzerState = mockBuzzer.getState();
+    switchedOnCount = 0;
+
+    for (uint32_t ms = 0; ms < 10ul * 60ul * 1000ul; ++ms) {
+        if (ms % 300 == 0) {
+            if ((ms / 300) % 2 == 0) {
+                alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Major);
+            } else {
+                alarmStation.clearAlarm(alarmCode);
+            }
+        }
+        loop();
+        if (mockBuzzer.getState() != buzzerState) {
+            buzzerState = mockBuzzer.getState();
+            switchedOnCount += mockBuzzer.isInState(Switched::On) ? 1 : 0;
+        }
+    }
+    return alarmStation.alarmList.getModificationCount();
+}
+
+static void shouldBoundAlarmTrafficOfNoisySensor() {
+    /* given */
+    AlarmFlapFilter flapFilter{};
+    uint16_t unfilteredSwitchedOnCount = 0;
+    uint16_t filteredSwitchedOnCount = 0;
+
+    /* when */
+    uint16_t unfilteredModifications = playNoisySensor(nullptr, unfilteredSwitchedOnCount);
+    uint16_t filteredModifications = playNoisySensor(&flapFilter, filteredSwitchedOnCount);
+
+    /* then */
+    assert(unfilteredModifications == 2000);
+    assert(filteredModifications <= 7 + 600 / 320);
+    assert(filteredSwitchedOnCount <= unfilteredSwitchedOnCount); // <- the notify period bounds both
+
+    std::cout << "ok -> shouldBoundAlarmTrafficOfNoisySensor"
+              << " (modifications " << unfilteredModifications << " -> " << filteredModifications
+              << ", buzzer switched on " << unfilteredSwitchedOnCount << " -> " << filteredSwitchedOnCount << ")\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldApplyFirstReportAtOnceAndHoldTheNext();
+        shouldCancelDeferredChangeThatReturns();
+        shouldBackOffExponentiallyWhileFlapping();
+        shouldForgetOldChangesAfterSixteenBitsOfSlots();
+        shouldKeepHoldAcrossMillisRollover();
+        shouldRemoveFilteredAlarmAtOnce();
+        shouldBoundAlarmTrafficOfNoisySensor();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
@@ -0,0 +1,258 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <iostream>
+#include <chrono>
+
+#include "../_Mocks/MockCommon.h"
+
+#include <Abstract/AbstractRunnable.h>
+
+#include "Enums/AlarmCode.h"
+#include "Enums/AlarmSeverity.h"
+#include "AlarmStation/AlarmStation.h"
+#include "AlarmStation/AlarmNotifyConfiguration.h"
+
+#include "../_Mocks/MockBuzzer.h"
+
+static LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> alarmNotifyConfigurations{};
+
+static AlarmCode const alarmCode = AlarmCode::AtoTopOffFailed;
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static void loop(uint32_t forwardMs) {
+    for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+        loop();
+    }
+}
+
+/**
+ * <br/>
+ * Keeps the events it is pushed, in order.
+ */
+class RecordingObserver : public AbstractObserver<AlarmEvent> {
+
+public:
+
+    static constexpr uint8_t capacity = 16;
+
+    AlarmEvent events[capacity];
+    uint8_t eventCount = 0;
+
+    void update(AlarmEvent const &event) override {
+        if (eventCount < capacity) {
+            events[eventCount] = event;
+        }
+        ++eventCount;
+    }
+
+    bool hasLast(AlarmEventType const eventType, AlarmSeverity const alarmSeverity) const {
+        if (eventCount == 0 || eventCount > capacity) {
+            return false;
+        }
+        AlarmEvent const &event = events[eventCount - 1];
+        return event.type == eventType && event.code == alarmCode && event.severity == alarmSeverity;
+    }
+};
+
+template<typename S>
+static void shouldPushEveryChangeOfStoredAlarm() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    BasicAlarmStation<S> alarmStation{mockBuzzer, alarmNotifyConfigurations};
+    RecordingObserver observer{};
+    alarmStation.registerObserver(observer);
+
+    /* when & then, persisting conditions are pushed once */
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Major);
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Major);
+    loop();
+    assert(observer.eventCount == 1);
+    assert(observer.hasLast(AlarmEventType::Raised, AlarmSeverity::Major));
+
+    alarmStation.clearAlarm(alarmCode);
+    alarmStation.clearAlarm(alarmCode);
+    assert(observer.eventCount == 2);
+    assert(observer.hasLast(AlarmEventType::Cleared, AlarmSeverity::Major));
+
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Critical);
+    assert(observer.hasLast(AlarmEventType::Raised, AlarmSeverity::Critical));
+
+    alarmStation.acknowledge(alarmCode);
+    alarmStation.acknowledge(alarmCode);
+    assert(observer.eventCount == 4);
+    assert(observer.hasLast(AlarmEventType::Acknowledged, AlarmSeverity::Critical));
+    assert(alarmStation.alarmList.isAcknowledged(alarmCode));
+
+    alarmStation.removeAlarm(alarmCode);
+    alarmStation.removeAlarm(alarmCode);
+    assert(observer.eventCount == 5);
+    assert(observer.hasLast(AlarmEventType::Removed, AlarmSeverity::Critical));
+
+    /* when, unregistered */
+    alarmStation.unregisterObserver(observer);
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Major);
+
+    /* then */
+    assert(observer.eventCount == 5);
+
+    std::cout << "ok -> shouldPushEveryChangeOfStoredAlarm\n";
+}
+
+template<typename S>
+static void shouldPushChangesMadeThroughTheStorage() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    BasicAlarmStation<S> alarmStation{mockBuzzer, alarmNotifyConfigurations};
+    RecordingObserver observer{};
+    alarmStation.registerObserver(observer);
+
+    /* when */
+    alarmStation.alarmList.add(alarmCode, AlarmSeverity::Minor);
+    loop();
+
+    /* then */
+    assert(observer.eventCount == 1);
+    assert(observer.hasLast(AlarmEventType::Raised, AlarmSeverity::Minor));
+
+    /* when, before the next change of the station */
+    alarmStation.alarmList.acknowledge(alarmCode);
+    alarmStation.raiseAlarm(AlarmCode::AtoHighLevel, AlarmSeverity::Critical);
+
+    /* then, in order */
+    assert(observer.eventCount == 3);
+    assert(observer.events[1].type == AlarmEventType::Acknowledged && observer.events[1].code == alarmCode);
+    assert(observer.events[2].type == AlarmEventType::Raised && observer.events[2].code == AlarmCode::AtoHighLevel);
+
+    /* when, raised again with a new severity */
+    alarmStation.alarmList.add(alarmCode, AlarmSeverity::Major);
+    loop();
+
+    /* then */
+    assert(observer.eventCount == 4);
+    assert(observer.hasLast(AlarmEventType::Raised, AlarmSeverity::Major));
+
+    /* when */
+    alarmStation.alarmList.remove(alarmCode);
+    loop();
+
+    /* then */
+    assert(observer.eventCount == 5);
+    assert(observer.hasLast(AlarmEventType::Removed, AlarmSeverity::Major));
+
+    /* when, nothing changed */
+    loop(100);
+
+    /* then */
+    assert(observer.eventCount == 5);
+
+    std::cout << "ok -> shouldPushChangesMadeThroughTheStorage\n";
+}
+
+static void shouldPushEscalationAndDeferredChanges() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    FixedAlarmStation alarmStation{mockBuzzer, alarmNotifyConfigurations};
+    AlarmEscalation alarmEscalation{};
+    alarmEscalation.setRule(AlarmSeverity::Minor, AlarmSeverity::Major, 1);
+    alarmStation.attachEscalation(&alarmEscalation);
+    AlarmFlapFilter flapFilter{};
+    alarmStation.attachFlapFilter(&flapFilter);
+    RecordingObserver observer{};
+    alarmStation.registerObserver(observer);
+
+    /* when */
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Minor);
+    loop(60ul * 1000ul + 2);
+
+    /* then */
+    assert(observer.eventCount == 2);
+    assert(observer.hasLast(AlarmEventType::Escalated, AlarmSeverity::Major));
+
+    /* when, cleared and raised within the hold time */
+    alarmStation.clearAlarm(alarmCode);
+    loop(100);
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Minor);
+    alarmStation.clearAlarm(alarmCode);
+
+    /* then, nothing reached the storage yet */
+    assert(observer.eventCount == 3);
+    assert(observer.hasLast(AlarmEventType::Cleared, AlarmSeverity::Major));
+
+    std::cout << "ok -> shouldPushEscalationAndDeferredChanges\n";
+}
+
+static void shouldKeepFixedNumberOfObserversInOrder() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    FixedAlarmStation alarmStation{mockBuzzer, alarmNotifyConfigurations};
+    RecordingObserver observers[ALARM_OBSERVER_COUNT + 1];
+
+    /* when */
+    for (RecordingObserver &observer : observers) {
+        alarmStation.registerObserver(observer);
+    }
+    alarmStation.registerObserver(observers[0]);
+
+    /* then */
+    assert(alarmStation.getObserverCount() == ALARM_OBSERVER_COUNT);
+    assert(!alarmStation.isRegistered(observers[ALARM_OBSERVER_COUNT]));
+
+    /* when */
+    alarmStation.unregisterObserver(observers[1]);
+    alarmStation.raiseAlarm(alarmCode, AlarmSeverity::Minor);
+
+    /* then */
+    assert(alarmStation.getObserverCount() == ALARM_OBSERVER_COUNT - 1);
+    assert(observers[0].eventCount == 1);
+    assert(observers[1].eventCount == 0);
+    assert(observers[2].eventCount == 1);
+    assert(observers[ALARM_OBSERVER_COUNT].eventCount == 0);
+
+    /* when */
+    alarmStation.notifyObservers();
+
+    /* then */
+    assert(observers[0].eventCount == 2);
+    assert(observers[0].hasLast(AlarmEventType::Raised, AlarmSeverity::Minor));
+
+    std::cout << "ok -> shouldKeepFixedNumberOfObserversInOrder\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldPushEveryChangeOfStoredAlarm<AlarmList>();
+        shouldPushEveryChangeOfStoredAlarm<AlarmArray<ALARM_CODE_COUNT>>();
+        shouldPushChangesMadeThroughTheStorage<AlarmList>();
+        shouldPushChangesMadeThroughTheStorage<AlarmArray<ALARM_CODE_COUNT>>();
+        shouldPushEscalationAndDeferredChanges();
+        shouldKeepFixedNumberOfObserversInOrder();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
@@ -163,18 +163,14 @@ static void shouldPeriodicallySoundAlarms() {
             if (mockBuzzer.isInState(Switched::On)) {
                 //std::cout << (seconds) << "\t\t switched :: ON\n";
                 assert(
-                        seconds == 0 || // <- the major alarm
-                        seconds == 10 || seconds == 70 || seconds == 130 || seconds == 190 || seconds == 250 || // <- the critical alarm, 1 min period
-                        seconds == 300 || // <- the major alarm, 5min period
-                        seconds == 310 || seconds == 370 || seconds == 430 || seconds == 490 || seconds == 550  // <- the critical alarm
+                        seconds == 0 || seconds == 60 || seconds == 120 || seconds == 180 || seconds == 240 || // <- the critical alarm first, 1 min period
+                        seconds == 12 // <- the major alarm, after the critical notification + rest period
                 );
             } else {
                 //std::cout << (seconds) << "\t\t switched :: OFF\n";
                 assert(
-                        seconds == 5 || // <- the major alarm
-                        seconds == 17 || seconds == 77 || seconds == 137 || seconds == 197 || seconds == 257 || // <- the critical alarm, 1 min period
-                        seconds == 305 || // <- the major alarm, 5min period
-                        seconds == 317 || seconds == 377 || seconds == 437 || seconds == 497 || seconds == 557 // <- the critical alarm, 1 min period
+                        seconds == 7 || seconds == 67 || seconds == 127 || seconds == 187 || seconds == 247 || // <- the critical alarm
+                        seconds == 17 // <- the major alarm
                 );
             }
         }
@@ -184,19 +180,15 @@ static void shouldPeriodicallySoundAlarms() {
             if (buzzerBusyState) {
                 //std::cout << (seconds) << "\tbusy :: " << static_cast<int>(buzzerBusyState) << "\n";
                 assert(
-                        seconds == 0 || // <- the major alarm
-                        seconds == 10 || seconds == 70 || seconds == 130 || seconds == 190 || seconds == 250 || // <- the critical alarm, 1 min period
-                        seconds == 300 || // <- the major alarm, 5min period
-                        seconds == 310 || seconds == 370 || seconds == 430 || seconds == 490 || seconds == 550  // <- the critical alarm
+                        seconds == 0 || seconds == 60 || seconds == 120 || seconds == 180 || seconds == 240 || // <- the critical alarm
+                        seconds == 12 // <- the major alarm
                 );
             } else {
                 //std::cout << (seconds) << "\tbusy :: " << static_cast<int>(buzzerBusyState) << "\n";
                 assert(
-                        seconds == 10 || // <- end of the major alarm notification + rest period
-                        seconds == 22 || seconds == 82 || seconds == 142 || seconds == 202 || seconds == 262 ||
-                        // <- end of the critical alarm notification + rest period
-                        seconds == 310 || // <- end of the major alarm notification + rest period, 5min period
-                        seconds == 322 || seconds == 382 || seconds == 442 || seconds == 502 || seconds == 562 // <- the critical alarm, 1 min period
+                        seconds == 12 || // <- end of the critical alarm notification + rest period
+                        seconds == 22 || // <- end of the major alarm notification + rest period, next one after 5 min
+                        seconds == 72 || seconds == 132 || seconds == 192 || seconds == 252 // <- end of the critical alarm notification + rest period
                 );
             }
         }
@@ -249,6 +241,168 @@ static void shouldGoToStateActiveAfterSleepPeriod() {
     std::cout << "ok -> shouldGoToStateActiveAfterSleepPeriod\n";
 }
 
+static void shouldRaiseAndClearAlarmOnlyOnStateChange() {
+    /* given */
+    MockBuzzer mockBuzzer{};
+    AlarmStation alarmStation(mockBuzzer, alarmNotifyConfigurations);
+
+    /* when */
+    alarmStation.raiseAlarm(AlarmCode::AtoHighLevel, AlarmSeverity::Major);
+    alarmStation.alarmList.acknowledge(AlarmCode::AtoHighLevel); // <- user acknowledged
+    alarmStation.raiseAlarm(AlarmCode::AtoHighLevel, AlarmSeverity::Major);
+
+    /* then */
+    assert(alarmStation.isAlarmRaised(AlarmCode::AtoHighLevel));
+    assert(alarmStation.alarmList.size() == 1);
+    assert(alarmStation.alarmList.isAcknowledged(AlarmCode::AtoHighLevel));
+
+    /* when */
+    alarmStation.clearAlarm(AlarmCode::AtoHighLevel);
+    alarmStation.raiseAlarm(AlarmCode::AtoHighLevel, AlarmSeverity::Major);
+
+    /* then */
+    assert(!alarmStation.alarmList.isAcknowledged(AlarmCode::AtoHighLevel));
+
+    /* when */
+    alarmStation.clearAlarm(AlarmCode::AtoHighLevel);
+    alarmStation.alarmList.setAcknowledge(AlarmCode::AtoHighLevel, false);
+    alarmStation.clearAlarm(AlarmCode::AtoHighLevel);
+
+    /* then, clearing an already cleared alarm touches nothing */
+    assert(!alarmStation.isAlarmRaised(AlarmCode::AtoHighLevel));
+    assert(!alarmStation.alarmList.isAcknowledged(AlarmCode::AtoHighLevel));
+
+    /* when */
+    alarmStation.raiseAlarm(AlarmCode::NoAlarm, AlarmSeverity::Major);
+
+    /* then */
+    assert(alarmStation.alarmList.size() == 1);
+
+    std::cout << "ok -> shouldRaiseAndClearAlarmOnlyOnStateChange\n";
+}
+
+static void shouldForgetReportedStateOnRemoveAlarm() {
+    /* given */
+    MockBuzzer mockBuzzer{};
+    AlarmStation alarmStation(mockBuzzer, alarmNotifyConfigurations);
+    alarmStation.raiseAlarm(AlarmCode::AtoLowLevel, AlarmSeverity::Major);
+
+    /* when */
+    alarmStation.removeAlarm(AlarmCode::AtoLowLevel);
+
+    /* then */
+    assert(!alarmStation.isAlarmRaised(AlarmCode::AtoLowLevel));
+    assert(alarmStation.alarmList.isEmpty());
+
+    /* when */
+    alarmStation.raiseAlarm(AlarmCode::AtoLowLevel, AlarmSeverity::Major);
+
+    /* then */
+    assert(alarmStation.alarmList.contains(AlarmCode::AtoLowLevel));
+
+    std::cout << "ok -> shouldForgetReportedStateOnRemoveAlarm\n";
+}
+
+static void shouldOrderNotificationsByDeadlineThenSeverity() {
+    /* given */
+    AlarmNotificationQueue queue{};
+
+    /* when */
+    queue.push(UINT32_MAX - 10, AlarmCode::AtoLowLevel, AlarmSeverity::Minor);
+    queue.push(5, AlarmCode::AtoHighLevel, AlarmSeverity::Major); // <- after the millis() roll over
+    queue.push(UINT32_MAX - 10, AlarmCode::SystemMaxTemperatureReached, AlarmSeverity::Critical);
+
+    /* then */
+    assert(queue.size() == 3);
+    assert(queue.pop().code == AlarmCode::SystemMaxTemperatureReached);
+    assert(queue.pop().code == AlarmCode::AtoLowLevel);
+    assert(queue.pop().code == AlarmCode::AtoHighLevel);
+    assert(queue.isEmpty());
+
+    std::cout << "ok -> shouldOrderNotificationsByDeadlineThenSeverity\n";
+}
+
+static void shouldStopSoundingAlarmAcknowledgedInTheList() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    AlarmStation alarmStation(mockBuzzer, alarmNotifyConfigurations);
+    alarmStation.alarmList.add(AlarmCode::SystemMaxTemperatureReached, AlarmSeverity::Critical);
+    loop();
+    assert(mockBuzzer.isBusy());
+
+    /* when */
+    alarmStation.alarmList.acknowledge(AlarmCode::SystemMaxTemperatureReached);
+    loop(3ul * 60ul * 1000ul);
+
+    /* then */
+    assert(!mockBuzzer.isBusy());
+    assert(mockBuzzer.isInState(Switched::Off));
+
+    /* when, raised again, sounds at once */
+    alarmStation.alarmList.add(AlarmCode::SystemMaxTemperatureReached, AlarmSeverity::Critical);
+    loop();
+
+    /* then */
+    assert(mockBuzzer.isInState(Switched::On));
+
+    std::cout << "ok -> shouldStopSoundingAlarmAcknowledgedInTheList\n";
+}
+
+static void shouldPreemptLessSeverePatternWithCriticalAlarm() {
+    /* given */
+    MockBuzzer mockBuzzer{5000};
+    AlarmStation alarmStation(mockBuzzer, alarmNotifyConfigurations);
+    alarmStation.setPatternNotifications(true);
+    alarmStation.alarmList.add(AlarmCode::AtoLowLevel, AlarmSeverity::Minor);
+    loop();
+    assert(mockBuzzer.isPlaying());
+    assert(mockBuzzer.getPriority() == static_cast<uint8_t>(AlarmSeverity::Minor));
+
+    /* when */
+    alarmStation.alarmList.add(AlarmCode::SystemMaxTemperatureReached, AlarmSeverity::Critical);
+    loop();
+
+    /* then */
+    assert(mockBuzzer.isPlaying());
+    assert(mockBuzzer.getPriority() == static_cast<uint8_t>(AlarmSeverity::Critical));
+
+    /* when, a major alarm while the critical one sounds or rests */
+    alarmStation.alarmList.add(AlarmCode::AtoHighLevel, AlarmSeverity::Major);
+    loop(4000);
+
+    /* then, waits */
+    assert(mockBuzzer.getPriority() == static_cast<uint8_t>(AlarmSeverity::Critical));
+
+    /* when, the critical pattern and the rest are over */
+    loop(5000);
+
+    /* then, the major one sounds */
+    assert(mockBuzzer.getPriority() == static_cast<uint8_t>(AlarmSeverity::Major));
+
+    std::cout << "ok -> shouldPreemptLessSeverePatternWithCriticalAlarm\n";
+}
+
+template<typename S>
+static void shouldSoundEveryPendingAlarmCode() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    BasicAlarmStation<S> alarmStation(mockBuzzer, alarmNotifyConfigurations);
+
+    /* when, more alarms than the former queue size of 12 */
+    for (uint8_t code = 1; code < ALARM_CODE_COUNT; ++code) {
+        alarmStation.raiseAlarm(static_cast<AlarmCode>(code), AlarmSeverity::Minor);
+    }
+    loop(10ul * 60ul * 1000ul);
+
+    /* then */
+    assert(alarmStation.alarmList.size() == ALARM_CODE_COUNT - 1);
+    for (uint8_t code = 1; code < ALARM_CODE_COUNT; ++code) {
+        assert(alarmStation.alarmList.getLastNotificationMs(static_cast<AlarmCode>(code)) != 0);
+    }
+
+    std::cout << "ok -> shouldSoundEveryPendingAlarmCode\n";
+}
+
 int main(int argc, char *argv[]) {
 
     alarmNotifyConfigurations.put(AlarmSeverity::Critical, AlarmNotifyConfiguration(1, 7000));
@@ -275,6 +429,13 @@ int main(int argc, char *argv[]) {
 
         shouldGoToStateSleepingOnStartSleeping();
         shouldGoToStateActiveAfterSleepPeriod();
+        shouldRaiseAndClearAlarmOnlyOnStateChange();
+        shouldForgetReportedStateOnRemoveAlarm();
+        shouldOrderNotificationsByDeadlineThenSeverity();
+        shouldStopSoundingAlarmAcknowledgedInTheList();
+        shouldPreemptLessSeverePatternWithCriticalAlarm();
+        shouldSoundEveryPendingAlarmCode<AlarmList>();
+        shouldSoundEveryPendingAlarmCode<AlarmArray<ALARM_CODE_COUNT>>();
 
         if (repeat > 1) {
             std::cout << "------------------------------------------------------------\n";
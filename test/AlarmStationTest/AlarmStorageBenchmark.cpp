@@ -0,0 +1,198 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include "../_Mocks/MockCommon.h"
+
+#include <Abstract/AbstractRunnable.h>
+
+#include "Enums/AlarmCode.h"
+#include "Enums/AlarmSeverity.h"
+#include "AlarmStation/AlarmStation.h"
+#include "AlarmStation/AlarmNotifyConfiguration.h"
+
+#include "../_Mocks/MockBuzzer.h"
+
+static LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> alarmNotifyConfigurations{};
+
+static AlarmCode const codes[] = {
+        AlarmCode::SystemMaxTemperatureReached,
+        AlarmCode::WaterMaxTemperatureReached,
+        AlarmCode::AmbientMaxHumidityReached,
+        AlarmCode::AtoTopOffFailed,
+        AlarmCode::AtoReservoirLow,
+        AlarmCode::AtoHighLevel,
+        AlarmCode::Ato2LowLevel,
+        AlarmCode::Ato4LowLevel,
+};
+
+static uint8_t const codeCount = sizeof(codes) / sizeof(codes[0]);
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static AlarmSeverity severityOf(uint8_t const index) {
+    return static_cast<AlarmSeverity>(index % 4);
+}
+
+/**
+ * <br/>
+ * Raises, clears and removes alarms through the station interface, records when the buzzer switches on.
+ */
+template<typename S>
+static std::vector<uint32_t> playScenario() {
+    MockBuzzer mockBuzzer{1000};
+    BasicAlarmStation<S> alarmStation{mockBuzzer, alarmNotifyConfigurations};
+    AbstractAlarmStation &station = alarmStation;
+    std::vector<uint32_t> switchedOnMs{};
+    Switched buzzerState = mockBuzzer.getState();
+
+    for (uint32_t ms = 0; ms < 20ul * 60ul * 1000ul; ++ms) {
+        uint32_t second = ms / 1000;
+        if (ms % 1000 == 0 && second < 8 * codeCount) {
+            uint8_t index = static_cast<uint8_t>(second % codeCount);
+            switch (second / codeCount) {
+                case 0:
+                case 3:
+                    station.raiseAlarm(codes[index], severityOf(index));
+                    break;
+                case 1:
+                    if (index % 2) {
+                        station.clearAlarm(codes[index]);
+                    }
+                    break;
+                case 2:
+                    if (index % 3 == 0) {
+                        station.removeAlarm(codes[index]);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        loop();
+        if (mockBuzzer.getState() != buzzerState) {
+            buzzerState = mockBuzzer.getState();
+            if (buzzerState == Switched::On) {
+                switchedOnMs.push_back(ms);
+            }
+        }
+    }
+    return switchedOnMs;
+}
+
+/**
+ * <br/>
+ * Host nanoseconds per raise / clear pair, and per queue rebuild with every code pending.
+ */
+template<typename S>
+static void benchmark(char const *name) {
+    MockBuzzer mockBuzzer{};
+    BasicAlarmStation<S> alarmStation{mockBuzzer, alarmNotifyConfigurations};
+    AbstractAlarmStation &station = alarmStation;
+    uint32_t const rounds = 20000;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint32_t round = 0; round < rounds; ++round) {
+        for (uint8_t index = 0; index < codeCount; ++index) {
+            station.raiseAlarm(codes[index], severityOf(index));
+            station.clearAlarm(codes[index]);
+        }
+    }
+    std::chrono::duration<double, std::nano> raiseClear = std::chrono::high_resolution_clock::now() - start;
+
+    for (uint8_t index = 0; index < codeCount; ++index) {
+        station.raiseAlarm(codes[index], severityOf(index));
+    }
+    uint32_t pendingCount = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (uint32_t round = 0; round < rounds; ++round) {
+        alarmStation.alarmList.forEachPending([&pendingCount](AlarmCode const, AlarmSeverity const, uint32_t const) {
+            ++pendingCount;
+        });
+    }
+    std::chrono::duration<double, std::nano> iterate = std::chrono::high_resolution_clock::now() - start;
+    assert(pendingCount == rounds * codeCount);
+
+    std::cout << "   " << name
+              << "\tsizeof: " << sizeof(alarmStation.alarmList)
+              << "\traise + clear: " << raiseClear.count() / (rounds * codeCount) << " ns"
+              << "\titerate " << static_cast<int>(codeCount) << " pending: " << iterate.count() / rounds << " ns\n";
+}
+
+static void shouldSoundTheSameWithEveryStorage() {
+    /* given */
+    std::vector<uint32_t> listSwitchedOnMs = playScenario<AlarmList>();
+
+    /* when */
+    std::vector<uint32_t> arraySwitchedOnMs = playScenario<AlarmArray<ALARM_CODE_COUNT>>();
+
+    /* then */
+    assert(!listSwitchedOnMs.empty());
+    assert(listSwitchedOnMs == arraySwitchedOnMs);
+
+    std::cout << "ok -> shouldSoundTheSameWithEveryStorage\n";
+}
+
+static void shouldAttachEveryStorageAsAbstractAlarmStation() {
+    /* given */
+    MockBuzzer mockBuzzer{};
+    FixedAlarmStation alarmStation{mockBuzzer, alarmNotifyConfigurations};
+    AbstractAlarmStation *pAlarmStation = &alarmStation;
+
+    /* when */
+    pAlarmStation->raiseAlarm(AlarmCode::Ato4HighLevel, AlarmSeverity::Major);
+    pAlarmStation->raiseAlarm(AlarmCode::AtoLowLevel, AlarmSeverity::Minor);
+    pAlarmStation->clearAlarm(AlarmCode::AtoLowLevel);
+
+    /* then */
+    assert(alarmStation.alarmList.size() == 2);
+    assert(!alarmStation.alarmList.isAcknowledged(AlarmCode::Ato4HighLevel));
+    assert(alarmStation.alarmList.isAcknowledged(AlarmCode::AtoLowLevel));
+    assert(alarmStation.alarmList.getHighestPendingAlarm() == AlarmCode::Ato4HighLevel);
+
+    std::cout << "ok -> shouldAttachEveryStorageAsAbstractAlarmStation\n";
+}
+
+int main(int argc, char *argv[]) {
+
+    alarmNotifyConfigurations.put(AlarmSeverity::Critical, AlarmNotifyConfiguration(1, 7000));
+    alarmNotifyConfigurations.put(AlarmSeverity::Major, AlarmNotifyConfiguration(5, 5000));
+    alarmNotifyConfigurations.put(AlarmSeverity::Minor, AlarmNotifyConfiguration(15, 3000));
+    alarmNotifyConfigurations.put(AlarmSeverity::NoSeverity, AlarmNotifyConfiguration(60, 1000));
+
+    std::cout << "\n"
+              << "------------------------------------------------------------\n"
+              << " >> TEST START\n"
+              << "------------------------------------------------------------\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldSoundTheSameWithEveryStorage();
+        shouldAttachEveryStorageAsAbstractAlarmStation();
+
+        benchmark<AlarmList>("AlarmList");
+        benchmark<AlarmArray<ALARM_CODE_COUNT>>("AlarmArray");
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------\n"
+              << " >> TEST END\n"
+              << "------------------------------------------------------------\n"
+              << "\n";
+
+    return 0;
+}
@@ -0,0 +1,419 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <iostream>
+#include <chrono>
+
+#include <Common/Centi.h>
+#include <Common/LinkedMap.h>
+#include <Common/Sensor.h>
+#include <Common/Switchable.h>
+#include <AmbientStation/AmbientRule.h>
+#include <AmbientStation/AmbientStation.h>
+#include <AmbientStation/WaterTemperatureSensorConnection.h>
+#include <AlarmStation/AlarmStation.h>
+#include "../_Mocks/MockBuzzer.h"
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static void loop(uint32_t forwardMs) {
+    for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+        loop();
+    }
+}
+
+static LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> alarmNotifyConfigurations{};
+static MockBuzzer buzzer{};
+
+static const AmbientRule ambientRules[] = {
+        {AmbientInput::WaterTemperature, Comparator::Below, Centi::fromFloat(24.4f), Centi::fromFloat(0.2f),
+                AmbientActuator::WaterHeater, 0, 0,
+                Centi::fromWhole(22), AlarmCode::WaterMinTemperatureReached, AlarmSeverity::Major},
+        {AmbientInput::WaterTemperature, Comparator::Above, Centi::fromFloat(25.6f), Centi(),
+                AmbientActuator::WaterCooler, 2, 3,
+                Centi::fromWhole(28), AlarmCode::WaterMaxTemperatureReached, AlarmSeverity::Major},
+        {AmbientInput::AmbientHumidity, Comparator::Above, Centi::fromWhole(64), Centi(),
+                AmbientActuator::AmbientFan, 0, 0,
+                Centi::fromWhole(90), AlarmCode::AmbientMaxHumidityReached, AlarmSeverity::Minor},
+        {AmbientInput::AmbientTemperature, Comparator::Above, Centi::fromWhole(36), Centi(),
+                AmbientActuator::AmbientFan, 0, 0,
+                Centi::fromWhole(32), AlarmCode::AmbientMaxTemperatureReached, AlarmSeverity::Minor},
+        {AmbientInput::SystemTemperature, Comparator::Above, Centi(), Centi(),
+                AmbientActuator::None, 0, 0,
+                Centi::fromWhole(46), AlarmCode::SystemMaxTemperatureReached, AlarmSeverity::Minor},
+};
+
+struct Fixture {
+    AlarmStation alarmStation{buzzer, alarmNotifyConfigurations};
+    AmbientStation ambientStation{};
+    Switchable ambientFan{};
+    Switchable waterCooler{};
+    Switchable waterHeater{};
+
+    Fixture() {
+        ambientStation.setRules(ambientRules, sizeof(ambientRules) / sizeof(AmbientRule));
+        ambientStation.attachAlarmStation(alarmStation);
+        ambientStation.attachActuator(AmbientActuator::AmbientFan, ambientFan);
+        ambientStation.attachActuator(AmbientActuator::WaterCooler, waterCooler);
+        ambientStation.attachActuator(AmbientActuator::WaterHeater, waterHeater);
+    }
+};
+
+static void shouldNotSwitchOnInputsNeverSet() {
+    /* given */
+    Fixture fixture{};
+
+    /* when */
+    loop();
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::Off));
+    assert(fixture.waterCooler.isInState(Switched::Off));
+    assert(fixture.ambientFan.isInState(Switched::Off));
+    assert(fixture.alarmStation.alarmList.isEmpty());
+
+    std::cout << "ok -> shouldNotSwitchOnInputsNeverSet\n";
+}
+
+static void shouldSwitchHeaterWithHysteresis() {
+    /* given */
+    Fixture fixture{};
+
+    /* when */
+    fixture.ambientStation.setWaterTemperature(Centi::fromFloat(24.39f));
+    loop();
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::On));
+
+    /* when, inside the hysteresis band */
+    fixture.ambientStation.setWaterTemperature(Centi::fromFloat(24.59f));
+    loop();
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::On));
+
+    /* when */
+    fixture.ambientStation.setWaterTemperature(Centi::fromFloat(24.6f));
+    loop();
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::Off));
+
+    /* when, inside the band from above */
+    fixture.ambientStation.setWaterTemperature(Centi::fromFloat(24.5f));
+    loop();
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::Off));
+
+    std::cout << "ok -> shouldSwitchHeaterWithHysteresis\n";
+}
+
+static void shouldCombineRulesOnTheSameActuator() {
+    /* given */
+    Fixture fixture{};
+    fixture.ambientStation.setAmbientHumidity(Centi::fromWhole(50));
+    fixture.ambientStation.setAmbientTemperature(Centi::fromWhole(30));
+    loop();
+    assert(fixture.ambientFan.isInState(Switched::Off));
+
+    /* when */
+    fixture.ambientStation.setAmbientHumidity(Centi::fromWhole(70));
+    loop();
+
+    /* then */
+    assert(fixture.ambientFan.isInState(Switched::On));
+
+    /* when */
+    fixture.ambientStation.setAmbientHumidity(Centi::fromWhole(50));
+    fixture.ambientStation.setAmbientTemperature(Centi::fromWhole(37));
+    loop();
+
+    /* then */
+    assert(fixture.ambientFan.isInState(Switched::On));
+
+    /* when */
+    fixture.ambientStation.setAmbientTemperature(Centi::fromWhole(30));
+    loop();
+
+    /* then */
+    assert(fixture.ambientFan.isInState(Switched::Off));
+
+    std::cout << "ok -> shouldCombineRulesOnTheSameActuator\n";
+}
+
+static void shouldKeepMinimumOnAndOffTime() {
+    /* given */
+    Fixture fixture{};
+    fixture.ambientStation.setWaterTemperature(Centi::fromWhole(26));
+    loop();
+    assert(fixture.waterCooler.isInState(Switched::On));
+
+    /* when */
+    fixture.ambientStation.setWaterTemperature(Centi::fromWhole(25));
+    loop(1998);
+
+    /* then */
+    assert(fixture.waterCooler.isInState(Switched::On));
+    loop(2);
+    assert(fixture.waterCooler.isInState(Switched::Off));
+
+    /* when */
+    fixture.ambientStation.setWaterTemperature(Centi::fromWhole(26));
+    loop(2998);
+
+    /* then */
+    assert(fixture.waterCooler.isInState(Switched::Off));
+    loop(2);
+    assert(fixture.waterCooler.isInState(Switched::On));
+
+    std::cout << "ok -> shouldKeepMinimumOnAndOffTime\n";
+}
+
+static void shouldRaiseAndAcknowledgeAlarms() {
+    /* given */
+    Fixture fixture{};
+
+    /* when */
+    fixture.ambientStation.setWaterTemperature(Centi::fromFloat(21.99f));
+    fixture.ambientStation.setSystemTemperature(Centi::fromFloat(46.01f));
+    loop();
+
+    /* then */
+    assert(!fixture.alarmStation.alarmList.isAcknowledged(AlarmCode::WaterMinTemperatureReached));
+    assert(!fixture.alarmStation.alarmList.isAcknowledged(AlarmCode::SystemMaxTemperatureReached));
+    assert(fixture.alarmStation.alarmList.contains(AlarmCode::WaterMinTemperatureReached));
+    assert(fixture.alarmStation.alarmList.contains(AlarmCode::SystemMaxTemperatureReached));
+
+    /* when */
+    fixture.ambientStation.setWaterTemperature(Centi::fromWhole(22));
+    fixture.ambientStation.setSystemTemperature(Centi::fromWhole(46));
+    loop();
+
+    /* then */
+    assert(fixture.alarmStation.alarmList.isAcknowledged(AlarmCode::WaterMinTemperatureReached));
+    assert(fixture.alarmStation.alarmList.isAcknowledged(AlarmCode::SystemMaxTemperatureReached));
+
+    std::cout << "ok -> shouldRaiseAndAcknowledgeAlarms\n";
+}
+
+static void shouldSwitchOffDisabledActuator() {
+    /* given */
+    Fixture fixture{};
+    fixture.ambientStation.setWaterTemperature(Centi::fromWhole(21));
+    loop();
+    assert(fixture.waterHeater.isInState(Switched::On));
+    assert(fixture.alarmStation.alarmList.contains(AlarmCode::WaterMinTemperatureReached));
+
+    /* when */
+    fixture.ambientStation.setActuatorEnabled(AmbientActuator::WaterHeater, false);
+    loop();
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::Off));
+    assert(fixture.alarmStation.alarmList.isAcknowledged(AlarmCode::WaterMinTemperatureReached));
+
+    std::cout << "ok -> shouldSwitchOffDisabledActuator\n";
+}
+
+static void shouldFailSafeOnStaleInput() {
+    /* given */
+    Fixture fixture{};
+    WaterTemperatureSensorConnection<AmbientStation, Centi> connection{fixture.ambientStation};
+    Sensor<Centi> sensor{&connection, Centi::fromWhole(-100), 1000};
+    fixture.ambientStation.attachSensor(AmbientInput::WaterTemperature, sensor);
+    sensor.setReading(Centi::fromWhole(21));
+    loop();
+    assert(fixture.waterHeater.isInState(Switched::On));
+    assert(fixture.alarmStation.isAlarmRaised(AlarmCode::WaterMinTemperatureReached));
+
+    /* when */
+    loop(1001);
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::Off));
+    assert(!fixture.alarmStation.isAlarmRaised(AlarmCode::WaterMinTemperatureReached));
+    assert(fixture.alarmStation.isAlarmRaised(AlarmCode::WaterTemperatureSensorFault));
+
+    /* when */
+    sensor.setReading(Centi::fromWhole(24));
+    loop();
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::On));
+    assert(!fixture.alarmStation.isAlarmRaised(AlarmCode::WaterTemperatureSensorFault));
+    assert(fixture.alarmStation.alarmList.isAcknowledged(AlarmCode::WaterTemperatureSensorFault));
+
+    std::cout << "ok -> shouldFailSafeOnStaleInput\n";
+}
+
+static void shouldFailSafeOnSensorError() {
+    /* given */
+    Fixture fixture{};
+    WaterTemperatureSensorConnection<AmbientStation, Centi> connection{fixture.ambientStation};
+    Sensor<Centi> sensor{&connection, Centi::fromWhole(-100), 60000};
+    fixture.ambientStation.attachSensor(AmbientInput::WaterTemperature, sensor);
+    sensor.setReading(Centi::fromWhole(24));
+    loop();
+    assert(fixture.waterHeater.isInState(Switched::On));
+
+    /* when */
+    sensor.setError();
+    loop();
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::Off));
+    assert(fixture.alarmStation.isAlarmRaised(AlarmCode::WaterTemperatureSensorFault));
+
+    /* when, same value read again */
+    sensor.setReading(Centi::fromWhole(24));
+    loop();
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::On));
+    assert(!fixture.alarmStation.isAlarmRaised(AlarmCode::WaterTemperatureSensorFault));
+
+    std::cout << "ok -> shouldFailSafeOnSensorError\n";
+}
+
+static void shouldNotRaiseSensorFaultBeforeFirstReading() {
+    /* given */
+    Fixture fixture{};
+    WaterTemperatureSensorConnection<AmbientStation, Centi> connection{fixture.ambientStation};
+    Sensor<Centi> sensor{&connection, Centi::fromWhole(-100), 1000};
+    fixture.ambientStation.attachSensor(AmbientInput::WaterTemperature, sensor);
+
+    /* when */
+    loop(2000);
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::Off));
+    assert(!fixture.alarmStation.isAlarmRaised(AlarmCode::WaterTemperatureSensorFault));
+
+    std::cout << "ok -> shouldNotRaiseSensorFaultBeforeFirstReading\n";
+}
+
+static void shouldNotReevaluateWhileInputStaysStale() {
+    /* given */
+    Fixture fixture{};
+    WaterTemperatureSensorConnection<AmbientStation, Centi> connection{fixture.ambientStation};
+    Sensor<Centi> sensor{&connection, Centi::fromWhole(-100), 1000};
+    fixture.ambientStation.attachSensor(AmbientInput::WaterTemperature, sensor);
+    sensor.setReading(Centi::fromWhole(24));
+    loop(1001 + 1);
+    assert(fixture.waterHeater.isInState(Switched::Off));
+    uint16_t evaluationCount = fixture.ambientStation.getEvaluationCount();
+
+    /* when */
+    loop(10000);
+
+    /* then */
+    assert(fixture.ambientStation.getEvaluationCount() == evaluationCount);
+    assert(!fixture.ambientStation.hasPendingRules());
+
+    /* when, refreshed */
+    sensor.setReading(Centi::fromWhole(24));
+    loop();
+
+    /* then */
+    assert(fixture.ambientStation.getEvaluationCount() == evaluationCount + 1);
+    assert(fixture.waterHeater.isInState(Switched::On));
+
+    std::cout << "ok -> shouldNotReevaluateWhileInputStaysStale\n";
+}
+
+static void shouldEvaluateOnlyOnInputChange() {
+    /* given */
+    Fixture fixture{};
+    fixture.ambientStation.setWaterTemperature(Centi::fromWhole(24));
+    loop();
+    assert(fixture.waterHeater.isInState(Switched::On));
+    assert(!fixture.ambientStation.hasPendingRules());
+
+    /* when */
+    fixture.ambientStation.setWaterTemperature(Centi::fromWhole(24));
+
+    /* then */
+    assert(!fixture.ambientStation.hasPendingRules());
+
+    /* when */
+    fixture.ambientStation.setAmbientHumidity(Centi::fromWhole(50));
+
+    /* then */
+    assert(fixture.ambientStation.hasPendingRules());
+    loop();
+    assert(!fixture.ambientStation.hasPendingRules());
+    assert(fixture.waterHeater.isInState(Switched::On));
+
+    std::cout << "ok -> shouldEvaluateOnlyOnInputChange\n";
+}
+
+static void shouldReevaluateAfterInvalidateRules() {
+    /* given */
+    AmbientRule editableRules[] = {ambientRules[0]};
+    Fixture fixture{};
+    fixture.ambientStation.setRules(editableRules, 1);
+    fixture.ambientStation.setWaterTemperature(Centi::fromWhole(25));
+    loop();
+    assert(fixture.waterHeater.isInState(Switched::Off));
+
+    /* when */
+    editableRules[0].threshold = Centi::fromWhole(26);
+    loop();
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::Off));
+
+    /* when */
+    fixture.ambientStation.invalidateRules();
+    loop();
+
+    /* then */
+    assert(fixture.waterHeater.isInState(Switched::On));
+
+    std::cout << "ok -> shouldReevaluateAfterInvalidateRules\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldNotSwitchOnInputsNeverSet();
+        shouldSwitchHeaterWithHysteresis();
+        shouldCombineRulesOnTheSameActuator();
+        shouldKeepMinimumOnAndOffTime();
+        shouldRaiseAndAcknowledgeAlarms();
+        shouldSwitchOffDisabledActuator();
+        shouldFailSafeOnStaleInput();
+        shouldFailSafeOnSensorError();
+        shouldNotRaiseSensorFaultBeforeFirstReading();
+        shouldNotReevaluateWhileInputStaysStale();
+        shouldEvaluateOnlyOnInputChange();
+        shouldReevaluateAfterInvalidateRules();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
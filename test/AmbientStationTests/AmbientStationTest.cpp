@@ -6,11 +6,13 @@
 
 #include <Common/LinkedMap.h>
 #include <Common/RunnableFunction.h>
+#include <Common/Centi.h>
 #include <Common/FunctionList.h>
 #include <Common/Sensor.h>
 #include <Common/Switchable.h>
 #include <Enums/State.h>
 #include <AmbientStation/AmbientStation.h>
+#include <AlarmStation/AlarmStation.h>
 #include "../_Mocks/MockBuzzer.h"
 
 static void setup() {
@@ -28,11 +30,11 @@ static void loop(uint32_t forwardMs) {
 }
 
 static AmbientSettings ambientSettings{
-        24.2,
-        25.4,
-        42,
-        32,
-        66,
+        Centi::fromFloat(24.2f),
+        Centi::fromFloat(25.4f),
+        Centi::fromWhole(42),
+        Centi::fromWhole(32),
+        Centi::fromWhole(66),
         true,
         true
 };
@@ -49,10 +51,10 @@ Switchable systemFan{};
 Switchable waterCooler{};
 Switchable waterHeater{};
 
-Sensor<float> ambientHumiditySensor{-100.0f};
-Sensor<float> ambientTemperatureSensor{-100.0f};
-Sensor<float> systemTemperatureSensor{-100.0f};
-Sensor<float> waterTemperatureSensor{-100.0f};
+Sensor<Centi> ambientHumiditySensor{Centi::fromWhole(-100)};
+Sensor<Centi> ambientTemperatureSensor{Centi::fromWhole(-100)};
+Sensor<Centi> systemTemperatureSensor{Centi::fromWhole(-100)};
+Sensor<Centi> waterTemperatureSensor{Centi::fromWhole(-100)};
 
 //RunnableFunction ambientCoolingRules{[]() -> void {
 //    /* what to do while seeping */
@@ -149,7 +151,7 @@ Sensor<float> waterTemperatureSensor{-100.0f};
 //
 //    /* what to do with alarms */
 //    if (waterTemperatureSensor.getReading() < ambientSettings.waterMinTemperatureAlarmTrigger &&
-//        waterTemperatureSensor.getReading() > -99.0f) {
+//        waterTemperatureSensor.getReading() > Centi::fromWhole(-99)) {
 //        //
 //        alarmStation.alarmList.add(AlarmCode::WaterMinTemperatureReached, AlarmSeverity::Major);
 //    } else {
@@ -160,7 +162,7 @@ Sensor<float> waterTemperatureSensor{-100.0f};
 
 static void shouldSwitchOnWaterHeaterOnWaterTemperatureBelowHeaterTurnOffTemperature() {
     /* when */
-    waterTemperatureSensor.setReading(ambientSettings.stopWaterHeatingAtTemperature - 0.001f);
+    waterTemperatureSensor.setReading(ambientSettings.stopWaterHeatingAtTemperature - Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -172,7 +174,7 @@ static void shouldSwitchOnWaterHeaterOnWaterTemperatureBelowHeaterTurnOffTempera
 
 static void shouldSwitchOffWaterHeaterOnWaterTemperatureAboveHeaterTurnOffTemperature() {
     /* when */
-    waterTemperatureSensor.setReading(ambientSettings.stopWaterHeatingAtTemperature + 0.001f);
+    waterTemperatureSensor.setReading(ambientSettings.stopWaterHeatingAtTemperature + Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -184,7 +186,7 @@ static void shouldSwitchOffWaterHeaterOnWaterTemperatureAboveHeaterTurnOffTemper
 
 static void shouldSwitchOffWaterCoolerOnWaterTemperatureBelowCoolerTurnOnTemperature() {
     /* when */
-    waterTemperatureSensor.setReading(ambientSettings.startWaterCoolingAtTemperature - 0.001f);
+    waterTemperatureSensor.setReading(ambientSettings.startWaterCoolingAtTemperature - Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -196,7 +198,7 @@ static void shouldSwitchOffWaterCoolerOnWaterTemperatureBelowCoolerTurnOnTempera
 
 static void shouldSwitchOnWaterCoolerOnWaterTemperatureAboveCoolerTurnOnTemperature() {
     /* when */
-    waterTemperatureSensor.setReading(ambientSettings.startWaterCoolingAtTemperature + 0.001f);
+    waterTemperatureSensor.setReading(ambientSettings.startWaterCoolingAtTemperature + Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -208,7 +210,7 @@ static void shouldSwitchOnWaterCoolerOnWaterTemperatureAboveCoolerTurnOnTemperat
 
 static void shouldSwitchOffSystemFanOnSystemTemperatureBelowSystemTurnOnTemperature() {
     /* when */
-    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature - 0.001f);
+    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature - Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -220,7 +222,7 @@ static void shouldSwitchOffSystemFanOnSystemTemperatureBelowSystemTurnOnTemperat
 
 static void shouldSwitchOnSystemFanOnSystemTemperatureAboveSystemTurnOnTemperature() {
     /* when */
-    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature + 0.001f);
+    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature + Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -232,8 +234,8 @@ static void shouldSwitchOnSystemFanOnSystemTemperatureAboveSystemTurnOnTemperatu
 
 static void shouldSwitchOffAmbientFanOnAmbientTemperatureBelowAmbientTurnOnTemperature() {
     /* when */
-    ambientTemperatureSensor.setReading(ambientSettings.startAmbientFanAtTemperature - 0.001f);
-    ambientHumiditySensor.setReading(ambientSettings.startAmbientFanAtHumidity - 0.001f);
+    ambientTemperatureSensor.setReading(ambientSettings.startAmbientFanAtTemperature - Centi::fromRaw(1));
+    ambientHumiditySensor.setReading(ambientSettings.startAmbientFanAtHumidity - Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -245,7 +247,7 @@ static void shouldSwitchOffAmbientFanOnAmbientTemperatureBelowAmbientTurnOnTempe
 
 static void shouldSwitchOnAmbientFanOnAmbientTemperatureAboveAmbientTurnOnTemperature() {
     /* when */
-    ambientTemperatureSensor.setReading(ambientSettings.startAmbientFanAtTemperature + 0.001f);
+    ambientTemperatureSensor.setReading(ambientSettings.startAmbientFanAtTemperature + Centi::fromRaw(1));
     ambientHumiditySensor.setReading(ambientSettings.startAmbientFanAtHumidity);
     loop();
 
@@ -259,7 +261,7 @@ static void shouldSwitchOnAmbientFanOnAmbientTemperatureAboveAmbientTurnOnTemper
 static void shouldSwitchOnAmbientFanOnAmbientHumidityAboveAmbientTurnOnHumidity() {
     /* when */
     ambientTemperatureSensor.setReading(ambientSettings.startAmbientFanAtTemperature);
-    ambientHumiditySensor.setReading(ambientSettings.startAmbientFanAtHumidity + 0.001f);
+    ambientHumiditySensor.setReading(ambientSettings.startAmbientFanAtHumidity + Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -271,7 +273,7 @@ static void shouldSwitchOnAmbientFanOnAmbientHumidityAboveAmbientTurnOnHumidity(
 
 static void shouldRaiseAlarmOnWaterTemperatureBelowWaterMinAlarmTriggerTemperature() {
     /* when */
-    waterTemperatureSensor.setReading(ambientSettings.waterMinTemperatureAlarmTrigger - 0.001f);
+    waterTemperatureSensor.setReading(ambientSettings.waterMinTemperatureAlarmTrigger - Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -284,7 +286,7 @@ static void shouldRaiseAlarmOnWaterTemperatureBelowWaterMinAlarmTriggerTemperatu
 
 static void shouldRaiseAlarmOnWaterTemperatureAboveWaterMaxAlarmTriggerTemperature() {
     /* when */
-    waterTemperatureSensor.setReading(ambientSettings.waterMaxTemperatureAlarmTrigger + 0.001f);
+    waterTemperatureSensor.setReading(ambientSettings.waterMaxTemperatureAlarmTrigger + Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -297,7 +299,7 @@ static void shouldRaiseAlarmOnWaterTemperatureAboveWaterMaxAlarmTriggerTemperatu
 
 static void shouldRaiseAlarmOnSystemTemperatureAboveSystemMaxAlarmTriggerTemperature() {
     /* when */
-    systemTemperatureSensor.setReading(ambientSettings.systemMaxTemperatureAlarmTrigger + 0.001f);
+    systemTemperatureSensor.setReading(ambientSettings.systemMaxTemperatureAlarmTrigger + Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -310,7 +312,7 @@ static void shouldRaiseAlarmOnSystemTemperatureAboveSystemMaxAlarmTriggerTempera
 
 static void shouldRaiseAlarmOnAmbientTemperatureAboveAmbientMaxAlarmTriggerTemperature() {
     /* when */
-    ambientTemperatureSensor.setReading(ambientSettings.ambientMaxTemperatureAlarmTrigger + 0.001f);
+    ambientTemperatureSensor.setReading(ambientSettings.ambientMaxTemperatureAlarmTrigger + Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -323,7 +325,7 @@ static void shouldRaiseAlarmOnAmbientTemperatureAboveAmbientMaxAlarmTriggerTempe
 
 static void shouldRaiseAlarmOnAmbientHumidityAboveAmbientMaxAlarmTriggerHumidity() {
     /* when */
-    ambientHumiditySensor.setReading(ambientSettings.ambientMaxHumidityAlarmTrigger + 0.001f);
+    ambientHumiditySensor.setReading(ambientSettings.ambientMaxHumidityAlarmTrigger + Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -336,7 +338,7 @@ static void shouldRaiseAlarmOnAmbientHumidityAboveAmbientMaxAlarmTriggerHumidity
 
 static void shouldAcknowledgeAlarmOnWaterTemperatureAboveOrEqualToWaterMinAlarmTriggerTemperature() {
     /* when */
-    waterTemperatureSensor.setReading(ambientSettings.waterMinTemperatureAlarmTrigger - 0.001f);
+    waterTemperatureSensor.setReading(ambientSettings.waterMinTemperatureAlarmTrigger - Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -349,7 +351,7 @@ static void shouldAcknowledgeAlarmOnWaterTemperatureAboveOrEqualToWaterMinAlarmT
 
 static void shouldAcknowledgeAlarmOnWaterTemperatureBelowOrEqualToWaterMaxAlarmTriggerTemperature() {
     /* given */
-    waterTemperatureSensor.setReading(ambientSettings.waterMaxTemperatureAlarmTrigger + 0.001f);
+    waterTemperatureSensor.setReading(ambientSettings.waterMaxTemperatureAlarmTrigger + Centi::fromRaw(1));
     loop();
     assert(alarmStation.alarmList.contains(AlarmCode::WaterMaxTemperatureReached));
 
@@ -367,7 +369,7 @@ static void shouldAcknowledgeAlarmOnWaterTemperatureBelowOrEqualToWaterMaxAlarmT
 
 static void shouldAcknowledgeAlarmOnSystemTemperatureBelowOrEqualToSystemMaxAlarmTriggerTemperature() {
     /* given */
-    systemTemperatureSensor.setReading(ambientSettings.systemMaxTemperatureAlarmTrigger + 0.001f);
+    systemTemperatureSensor.setReading(ambientSettings.systemMaxTemperatureAlarmTrigger + Centi::fromRaw(1));
     loop();
     assert(alarmStation.alarmList.contains(AlarmCode::SystemMaxTemperatureReached));
     assert(!alarmStation.alarmList.isAcknowledged(AlarmCode::SystemMaxTemperatureReached));
@@ -386,7 +388,7 @@ static void shouldAcknowledgeAlarmOnSystemTemperatureBelowOrEqualToSystemMaxAlar
 
 static void shouldAcknowledgeAlarmOnAmbientTemperatureBelowOrEqualToAmbientMaxAlarmTriggerTemperature() {
     /* given */
-    ambientTemperatureSensor.setReading(ambientSettings.ambientMaxTemperatureAlarmTrigger + 0.001f);
+    ambientTemperatureSensor.setReading(ambientSettings.ambientMaxTemperatureAlarmTrigger + Centi::fromRaw(1));
     loop();
     assert(alarmStation.alarmList.contains(AlarmCode::AmbientMaxTemperatureReached));
 
@@ -404,7 +406,7 @@ static void shouldAcknowledgeAlarmOnAmbientTemperatureBelowOrEqualToAmbientMaxAl
 
 static void shouldAcknowledgeAlarmOnAmbientHumidityBelowOrEqualToAmbientMaxAlarmTriggerHumidity() {
     /* given */
-    ambientHumiditySensor.setReading(ambientSettings.ambientMaxHumidityAlarmTrigger + 0.001f);
+    ambientHumiditySensor.setReading(ambientSettings.ambientMaxHumidityAlarmTrigger + Centi::fromRaw(1));
     loop();
     assert(alarmStation.alarmList.contains(AlarmCode::AmbientMaxHumidityReached));
     assert(!alarmStation.alarmList.isAcknowledged(AlarmCode::AmbientMaxHumidityReached));
@@ -450,11 +452,11 @@ static void shouldGoToStateActiveAfterSleepPeriod() {
 
 static void shouldExecuteSwitchRuleToSwitchDeviceOn() {
     /* when */
-    systemTemperatureSensor.setReading(-100.0f);
+    systemTemperatureSensor.setReading(Centi::fromWhole(-100));
     loop();
     assert(systemFan.isInState(Switched::Off));
 
-    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature + 0.001f);
+    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature + Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -465,15 +467,15 @@ static void shouldExecuteSwitchRuleToSwitchDeviceOn() {
 
 static void shouldExecuteSwitchRuleToSwitchDeviceOff() {
     /* when */
-    systemTemperatureSensor.setReading(-100.0f);
+    systemTemperatureSensor.setReading(Centi::fromWhole(-100));
     loop();
     assert(systemFan.isInState(Switched::Off));
 
-    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature + 0.001f);
+    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature + Centi::fromRaw(1));
     loop();
     assert(systemFan.isInState(Switched::On));
 
-    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature - 0.001f);
+    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature - Centi::fromRaw(1));
     loop();
 
     /* then */
@@ -484,10 +486,10 @@ static void shouldExecuteSwitchRuleToSwitchDeviceOff() {
 
 static void shouldExecuteSwitchRuleWithUpdatedSettingsToSwitchDeviceOn() {
     /* when */
-    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature - 0.001f);
+    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature - Centi::fromRaw(1));
     loop();
     assert(systemFan.isInState(Switched::Off));
-    ambientSettings.startSystemFanAtTemperature -= 1;
+    ambientSettings.startSystemFanAtTemperature -= Centi::fromWhole(1);
     loop();
 
     /* then */
@@ -498,10 +500,10 @@ static void shouldExecuteSwitchRuleWithUpdatedSettingsToSwitchDeviceOn() {
 
 static void shouldExecuteSwitchRuleWithUpdatedSettingsToSwitchDeviceOff() {
     /* when */
-    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature + 0.001f);
+    systemTemperatureSensor.setReading(ambientSettings.startSystemFanAtTemperature + Centi::fromRaw(1));
     loop();
     assert(systemFan.isInState(Switched::On));
-    ambientSettings.startSystemFanAtTemperature += 1;
+    ambientSettings.startSystemFanAtTemperature += Centi::fromWhole(1);
     loop();
 
     /* then */
@@ -522,7 +524,7 @@ int main() {
     });
 
     ambientStation.rules.add([]() -> void {
-        if ((waterTemperatureSensor.getReading() < ambientSettings.waterMinTemperatureAlarmTrigger) && waterTemperatureSensor.getReading() > -99.0f) {
+        if ((waterTemperatureSensor.getReading() < ambientSettings.waterMinTemperatureAlarmTrigger) && waterTemperatureSensor.getReading() > Centi::fromWhole(-99)) {
             alarmStation.alarmList.add(AlarmCode::WaterMinTemperatureReached, AlarmSeverity::Major);
         } else {
             alarmStation.alarmList.acknowledge(AlarmCode::WaterMinTemperatureReached);
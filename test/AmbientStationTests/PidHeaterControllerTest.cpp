@@ -0,0 +1,311 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <iostream>
+#include <chrono>
+
+#include <Common/Centi.h>
+#include <Common/PidController.h>
+#include <Common/RelayAutotuner.h>
+#include <Common/Sensor.h>
+#include <Common/Switchable.h>
+#include <AmbientStation/PidHeaterController.h>
+#include <AmbientStation/ThresholdController.h>
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static void loop(uint32_t forwardMs) {
+    for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+        loop();
+    }
+}
+
+/**
+ * <br/>
+ * 60 L tank, 100 W heater with a 60 s element lag, probe with a 30 s lag and 1/16 °C resolution, 20 °C room.
+ */
+class WaterTankModel {
+
+private:
+
+    double heatFlow = 0;          // <- 0 .. 1 of the heater power reaching the water
+    double waterTemperature;
+    double probeTemperature;
+
+public:
+
+    explicit WaterTankModel(double const temperature) :
+            waterTemperature(temperature),
+            probeTemperature(temperature) {}
+
+    void step(bool const isHeaterOn) {
+        heatFlow += ((isHeaterOn ? 1.0 : 0.0) - heatFlow) / 60.0;
+        waterTemperature += 100.0 * heatFlow / (60.0 * 4186.0) - (waterTemperature - 20.0) * 5e-5;
+        probeTemperature += (waterTemperature - probeTemperature) / 30.0;
+    }
+
+    Centi getProbeReading() const {
+        return Centi::fromRaw(static_cast<int16_t>(static_cast<int32_t>(probeTemperature * 16.0 + 0.5) * 100 / 16));
+    }
+};
+
+struct SimulationResult {
+    uint16_t switchCount;
+    int16_t minRaw;
+    int16_t maxRaw;
+};
+
+/**
+ * <br/>
+ * Steps the model once per second for <tt>seconds</tt>, extremes are taken after <tt>settleSeconds</tt>.
+ */
+static SimulationResult simulate(WaterTankModel &model, Sensor<Centi> &sensor, Switchable &heater,
+                                 uint32_t const seconds, uint32_t const settleSeconds) {
+    SimulationResult result{0, INT16_MAX, INT16_MIN};
+    bool wasOn = heater.isInState(Switched::On);
+
+    for (uint32_t second = 0; second < seconds; ++second) {
+        model.step(heater.isInState(Switched::On));
+        sensor.setReading(model.getProbeReading());
+
+        for (uint16_t ms = 0; ms < 1000; ++ms) {
+            loop();
+            bool isOn = heater.isInState(Switched::On);
+            if (isOn != wasOn && second >= settleSeconds) {
+                ++result.switchCount;
+            }
+            wasOn = isOn;
+        }
+
+        int16_t raw = sensor.getReading().getRaw();
+        if (second >= settleSeconds) {
+            if (raw < result.minRaw) result.minRaw = raw;
+            if (raw > result.maxRaw) result.maxRaw = raw;
+        }
+    }
+    return result;
+}
+
+static void shouldComputeProportionalOutput() {
+    /* given */
+    PidController pidController{PidGains{2560, 0, 0}};
+
+    /* when, then */
+    assert(pidController.compute(2450, 2450) == 0);
+    assert(pidController.compute(2450, 2440) == 100);
+    assert(pidController.compute(2450, 2400) == 500);
+    assert(pidController.compute(2450, 2300) == 1000);
+    assert(pidController.compute(2450, 2500) == 0);
+
+    std::cout << "ok -> shouldComputeProportionalOutput\n";
+}
+
+static void shouldNotWindUpWhileSaturated() {
+    /* given */
+    PidController pidController{PidGains{256, 256, 0}};
+
+    /* when */
+    for (int i = 0; i < 1000; ++i) {
+        assert(pidController.compute(2450, 1000) == 1000);
+    }
+
+    /* then, output leaves saturation as soon as the error changes sign */
+    assert(pidController.compute(2450, 2460) < 1000);
+
+    /* when */
+    pidController.reset();
+
+    /* then */
+    assert(pidController.compute(2450, 2450) == 0);
+
+    std::cout << "ok -> shouldNotWindUpWhileSaturated\n";
+}
+
+static void shouldApplyDerivativeOnMeasurement() {
+    /* given */
+    PidController pidController{PidGains{0, 0, 2560}};
+    pidController.compute(2450, 2400);
+
+    /* when, a set point step gives no kick */
+    uint16_t afterSetPointStep = pidController.compute(2600, 2400);
+
+    /* then */
+    assert(afterSetPointStep == 0);
+
+    /* when, falling measurement pushes the output up */
+    uint16_t afterDrop = pidController.compute(2600, 2390);
+
+    /* then */
+    assert(afterDrop == 100);
+
+    std::cout << "ok -> shouldApplyDerivativeOnMeasurement\n";
+}
+
+static void shouldSwitchTimeProportionalWindow() {
+    /* given */
+    Sensor<Centi> sensor{Centi()};
+    Switchable heater{};
+    PidHeaterController<Sensor<Centi>, Switchable> controller{
+            sensor, heater, Centi::fromWhole(25), PidGains{2560, 0, 0}, 10000, 500};
+
+    /* when, 0.3 °C below -> 300 ‰ -> on for 3 s */
+    sensor.setReading(Centi::fromFloat(24.7f));
+    loop();
+
+    /* then */
+    assert(controller.getDuty() == 300);
+    assert(heater.isInState(Switched::On));
+    loop(2999);
+    assert(heater.isInState(Switched::On));
+    loop(1);
+    assert(heater.isInState(Switched::Off));
+    loop(6999);
+    assert(heater.isInState(Switched::Off));
+
+    /* when, 0.04 °C below -> 40 ‰ -> 400 ms pulse is dropped */
+    sensor.setReading(Centi::fromFloat(24.96f));
+    loop(1);
+
+    /* then */
+    assert(controller.getDuty() == 40);
+    assert(heater.isInState(Switched::Off));
+
+    std::cout << "ok -> shouldSwitchTimeProportionalWindow\n";
+}
+
+static void shouldSwitchOffOnStaleSensor() {
+    /* given */
+    Sensor<Centi> sensor{Centi(), 2000};
+    Switchable heater{};
+    PidHeaterController<Sensor<Centi>, Switchable> controller{
+            sensor, heater, Centi::fromWhole(25), PidGains{2560, 0, 0}};
+    sensor.setReading(Centi::fromWhole(20));
+    loop();
+    assert(heater.isInState(Switched::On));
+
+    /* when */
+    loop(2001);
+
+    /* then */
+    assert(heater.isInState(Switched::Off));
+    assert(controller.getDuty() == 0);
+
+    std::cout << "ok -> shouldSwitchOffOnStaleSensor\n";
+}
+
+static void shouldFailAutotuneWithGainsOutOfRange() {
+    /* given, 10 s window, the derivative of a 40 min limit cycle does not fit */
+    WaterTankModel model{24.0};
+    Sensor<Centi> sensor{model.getProbeReading(), 5000};
+    Switchable heater{};
+    PidHeaterController<Sensor<Centi>, Switchable> controller{
+            sensor, heater, Centi::fromFloat(24.5f), PidGains{2560, 40, 0}, 10000, 500};
+    controller.startAutotune(Centi::fromFloat(0.1f));
+
+    /* when */
+    simulate(model, sensor, heater, 4 * 3600, 0);
+
+    /* then */
+    assert(!controller.isInAutotune());
+    assert(controller.isAutotuneFailed());
+    assert(controller.getGains().kp == 2560 && controller.getGains().ki == 40 && controller.getGains().kd == 0);
+
+    std::cout << "ok -> shouldFailAutotuneWithGainsOutOfRange\n";
+}
+
+static void shouldAutotuneAndHoldTighterThanBangBang() {
+    /* given, bang-bang with 30 s minimum on/off time */
+    WaterTankModel bangBangModel{24.0};
+    Sensor<Centi> bangBangSensor{bangBangModel.getProbeReading(), 5000};
+    Switchable bangBangHeater{};
+    SimulationResult bangBang;
+    {
+        ThresholdController<Sensor<Centi>, Switchable> thermostat{
+                bangBangSensor, bangBangHeater, Centi::fromFloat(24.4f), Centi::fromFloat(24.6f), 30000, 30000};
+        bangBang = simulate(bangBangModel, bangBangSensor, bangBangHeater, 6 * 3600, 2 * 3600);
+    }
+
+    /* given, the former waterHeatingRules, one threshold and a 30 s count down */
+    WaterTankModel ruleModel{24.0};
+    Sensor<Centi> ruleSensor{ruleModel.getProbeReading(), 5000};
+    Switchable ruleHeater{};
+    SimulationResult rule;
+    {
+        ThresholdController<Sensor<Centi>, Switchable> thermostat{
+                ruleSensor, ruleHeater, Centi::fromFloat(24.4f), Centi::fromFloat(24.41f), 30000, 30000};
+        rule = simulate(ruleModel, ruleSensor, ruleHeater, 6 * 3600, 2 * 3600);
+    }
+
+    /* given, PID autotuned around the set point, default window */
+    WaterTankModel pidModel{24.0};
+    Sensor<Centi> pidSensor{pidModel.getProbeReading(), 5000};
+    Switchable pidHeater{};
+    SimulationResult pid;
+    {
+        PidHeaterController<Sensor<Centi>, Switchable> controller{
+                pidSensor, pidHeater, Centi::fromFloat(24.5f), PidGains{0, 0, 0}};
+        controller.startAutotune(Centi::fromFloat(0.1f));
+
+        /* when */
+        simulate(pidModel, pidSensor, pidHeater, 4 * 3600, 0);
+        assert(!controller.isInAutotune());
+        assert(!controller.isAutotuneFailed());
+        PidGains gains = controller.getGains();
+        std::cout << "   autotuned kp " << gains.kp << " ki " << gains.ki << " kd " << gains.kd << "\n";
+        assert(gains.kp > 0 && gains.ki > 0 && gains.kd > 0);
+        pid = simulate(pidModel, pidSensor, pidHeater, 6 * 3600, 2 * 3600);
+    }
+
+    std::cout << "   4 h settled, bang-bang: " << bangBang.switchCount << " switches, "
+              << bangBang.minRaw << " .. " << bangBang.maxRaw << "\n";
+    std::cout << "   4 h settled, old rule:  " << rule.switchCount << " switches, "
+              << rule.minRaw << " .. " << rule.maxRaw << "\n";
+    std::cout << "   4 h settled, pid:       " << pid.switchCount << " switches, "
+              << pid.minRaw << " .. " << pid.maxRaw << "\n";
+
+    /* then */
+    assert(pid.maxRaw - pid.minRaw < bangBang.maxRaw - bangBang.minRaw);
+    assert(pid.maxRaw - pid.minRaw <= rule.maxRaw - rule.minRaw);
+    assert(pid.switchCount <= rule.switchCount);
+    assert(pid.switchCount <= 4 * 3600 / 300); // <- twice per 10 min window at most
+
+    std::cout << "ok -> shouldAutotuneAndHoldTighterThanBangBang\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldComputeProportionalOutput();
+        shouldNotWindUpWhileSaturated();
+        shouldApplyDerivativeOnMeasurement();
+        shouldSwitchTimeProportionalWindow();
+        shouldSwitchOffOnStaleSensor();
+        shouldFailAutotuneWithGainsOutOfRange();
+        shouldAutotuneAndHoldTighterThanBangBang();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
@@ -0,0 +1,282 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <iostream>
+#include <chrono>
+
+#include <Common/Centi.h>
+#include <Common/LinkedMap.h>
+#include <Common/Sensor.h>
+#include <Common/Switchable.h>
+#include <AmbientStation/AmbientRule.h>
+#include <AmbientStation/ThresholdController.h>
+#include <AlarmStation/AlarmStation.h>
+#include "../_Mocks/MockBuzzer.h"
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static void loop(uint32_t forwardMs) {
+    for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+        loop();
+    }
+}
+
+static LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> alarmNotifyConfigurations{};
+static MockBuzzer buzzer{};
+
+static void shouldHeatWithHysteresis() {
+    /* given */
+    Sensor<Centi> sensor{Centi()};
+    Switchable heater{};
+    ThresholdController<Sensor<Centi>, Switchable> controller{
+            sensor, heater, Centi::fromFloat(24.4f), Centi::fromFloat(24.6f)};
+    assert(controller.isHeating());
+
+    /* when */
+    sensor.setReading(Centi::fromFloat(24.4f));
+    loop();
+
+    /* then */
+    assert(heater.isInState(Switched::Off));
+
+    /* when */
+    sensor.setReading(Centi::fromFloat(24.39f));
+    loop();
+
+    /* then */
+    assert(heater.isInState(Switched::On));
+
+    /* when */
+    sensor.setReading(Centi::fromFloat(24.59f));
+    loop();
+
+    /* then */
+    assert(heater.isInState(Switched::On));
+
+    /* when */
+    sensor.setReading(Centi::fromFloat(24.6f));
+    loop();
+
+    /* then */
+    assert(heater.isInState(Switched::Off));
+
+    std::cout << "ok -> shouldHeatWithHysteresis\n";
+}
+
+static void shouldCoolWithHysteresis() {
+    /* given */
+    Sensor<Centi> sensor{Centi()};
+    Switchable cooler{};
+    ThresholdController<Sensor<Centi>, Switchable> controller{
+            sensor, cooler, Centi::fromFloat(25.6f), Centi::fromFloat(25.4f)};
+    assert(!controller.isHeating());
+
+    /* when */
+    sensor.setReading(Centi::fromFloat(25.59f));
+    loop();
+
+    /* then */
+    assert(cooler.isInState(Switched::Off));
+
+    /* when */
+    sensor.setReading(Centi::fromFloat(25.6f));
+    loop();
+
+    /* then */
+    assert(cooler.isInState(Switched::On));
+
+    /* when */
+    sensor.setReading(Centi::fromFloat(25.4f));
+    loop();
+
+    /* then */
+    assert(cooler.isInState(Switched::On));
+
+    /* when */
+    sensor.setReading(Centi::fromFloat(25.39f));
+    loop();
+
+    /* then */
+    assert(cooler.isInState(Switched::Off));
+
+    std::cout << "ok -> shouldCoolWithHysteresis\n";
+}
+
+static void shouldKeepMinimumOnAndOffTime() {
+    /* given */
+    Sensor<Centi> sensor{Centi()};
+    Switchable cooler{};
+    ThresholdController<Sensor<Centi>, Switchable> controller{
+            sensor, cooler, Centi::fromWhole(26), Centi::fromWhole(25), 2000, 3000};
+
+    sensor.setReading(Centi::fromWhole(27));
+    loop();
+    assert(cooler.isInState(Switched::On));
+
+    /* when */
+    sensor.setReading(Centi::fromWhole(24));
+    loop(1998);
+
+    /* then */
+    assert(cooler.isInState(Switched::On));
+    loop(2);
+    assert(cooler.isInState(Switched::Off));
+
+    /* when */
+    sensor.setReading(Centi::fromWhole(27));
+    loop(2998);
+
+    /* then */
+    assert(cooler.isInState(Switched::Off));
+    loop(2);
+    assert(cooler.isInState(Switched::On));
+
+    std::cout << "ok -> shouldKeepMinimumOnAndOffTime\n";
+}
+
+static void shouldFailSafeOnStaleSensor() {
+    /* given */
+    Sensor<Centi> sensor{Centi(), 1000};
+    Switchable heater{};
+    ThresholdController<Sensor<Centi>, Switchable> controller{
+            sensor, heater, Centi::fromWhole(24), Centi::fromWhole(25)};
+
+    /* when */
+    loop();
+
+    /* then */
+    assert(heater.isInState(Switched::Off));
+
+    /* when */
+    sensor.setReading(Centi::fromWhole(20));
+    loop();
+
+    /* then */
+    assert(heater.isInState(Switched::On));
+
+    /* when */
+    loop(1001);
+
+    /* then */
+    assert(heater.isInState(Switched::Off));
+
+    /* when */
+    sensor.setReading(Centi::fromWhole(20));
+    sensor.setError();
+    loop();
+
+    /* then */
+    assert(heater.isInState(Switched::Off));
+
+    std::cout << "ok -> shouldFailSafeOnStaleSensor\n";
+}
+
+static void shouldRaiseAndAcknowledgeAlarmOnce() {
+    /* given */
+    AlarmStation alarmStation{buzzer, alarmNotifyConfigurations};
+    Sensor<Centi> sensor{Centi()};
+    Switchable heater{};
+    ThresholdController<Sensor<Centi>, Switchable> controller{
+            sensor, heater, Centi::fromWhole(24), Centi::fromWhole(25)};
+    controller.setAlarmBand(alarmStation, AlarmCode::WaterMinTemperatureReached, AlarmSeverity::Major,
+                            Centi::fromWhole(22), Centi::fromWhole(28));
+
+    /* when */
+    sensor.setReading(Centi::fromWhole(22));
+    loop();
+
+    /* then */
+    assert(!controller.isAlarming());
+    assert(alarmStation.alarmList.isEmpty());
+
+    /* when */
+    sensor.setReading(Centi::fromFloat(21.99f));
+    loop();
+
+    /* then */
+    assert(controller.isAlarming());
+    assert(alarmStation.alarmList.contains(AlarmCode::WaterMinTemperatureReached));
+    assert(!alarmStation.alarmList.isAcknowledged(AlarmCode::WaterMinTemperatureReached));
+
+    /* when */
+    sensor.setReading(Centi::fromWhole(23));
+    loop();
+
+    /* then */
+    assert(!controller.isAlarming());
+    assert(alarmStation.alarmList.isAcknowledged(AlarmCode::WaterMinTemperatureReached));
+
+    std::cout << "ok -> shouldRaiseAndAcknowledgeAlarmOnce\n";
+}
+
+static void shouldDecideLikeAmbientRule() {
+    /* given, the same heater as a controller and as a rule */
+    Sensor<Centi> sensor{Centi()};
+    Switchable heater{};
+    ThresholdController<Sensor<Centi>, Switchable> controller{
+            sensor, heater, Centi::fromFloat(24.4f), Centi::fromFloat(24.6f)};
+    AmbientRule rule{AmbientInput::WaterTemperature, Comparator::Below, Centi::fromFloat(24.4f), Centi::fromFloat(0.2f),
+                     AmbientActuator::WaterHeater, 0, 0, Centi(), AlarmCode::NoAlarm, AlarmSeverity::NoSeverity};
+    bool isRuleDemanding = false;
+
+    /* when & then, down and up through both thresholds */
+    for (int16_t raw = 2470; raw >= 2430; --raw) {
+        sensor.setReading(Centi::fromRaw(raw));
+        loop();
+        isRuleDemanding = rule.isDemanding(Centi::fromRaw(raw), isRuleDemanding);
+        assert(heater.isInState(Switched::On) == isRuleDemanding);
+    }
+    for (int16_t raw = 2430; raw <= 2470; ++raw) {
+        sensor.setReading(Centi::fromRaw(raw));
+        loop();
+        isRuleDemanding = rule.isDemanding(Centi::fromRaw(raw), isRuleDemanding);
+        assert(heater.isInState(Switched::On) == isRuleDemanding);
+    }
+
+    /* when & then, the dwell left */
+    HysteresisSwitch hysteresisSwitch{};
+    assert(hysteresisSwitch.getWaitMs(Switched::On, 3000, 5000, 100) == 0);
+    hysteresisSwitch.markSwitched(100);
+    assert(hysteresisSwitch.getWaitMs(Switched::Off, 3000, 5000, 1100) == 2000);
+    assert(hysteresisSwitch.getWaitMs(Switched::On, 3000, 5000, 1100) == 4000);
+    assert(hysteresisSwitch.getWaitMs(Switched::Off, 3000, 5000, 3100) == 0);
+
+    std::cout << "ok -> shouldDecideLikeAmbientRule\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldHeatWithHysteresis();
+        shouldCoolWithHysteresis();
+        shouldKeepMinimumOnAndOffTime();
+        shouldFailSafeOnStaleSensor();
+        shouldRaiseAndAcknowledgeAlarmOnce();
+        shouldDecideLikeAmbientRule();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
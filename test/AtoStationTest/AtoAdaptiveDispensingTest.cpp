@@ -0,0 +1,238 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+
+#include "../_Mocks/MockCommon.h"
+
+#include <Enums/Level.h>
+
+#include <AtoStation/AtoDispenseHistory.h>
+#include <AtoStation/AtoStation.h>
+#include <Common/Switchable.h>
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static void loop(uint32_t forwardMs) {
+    for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+        loop();
+    }
+}
+
+static AtoSettings adaptiveSettings() {
+    AtoSettings atoSettings{60ul * 1000ul, 90ul * 1000ul};
+    atoSettings.isAdaptive = true;
+    atoSettings.maxDispensingIntervalMs = 2ul * 60ul * 60ul * 1000ul;
+    atoSettings.targetDispensingDurationMs = 15ul * 1000ul;
+    atoSettings.minDispensingDurationMs = 10ul * 1000ul;
+    return atoSettings;
+}
+
+/**
+ * <br/>
+ * Normal level drops at the start, the top-off takes <tt>durationMs</tt>, the cycle lasts <tt>cycleMs</tt>.
+ */
+static void topOff(AtoStation &atoStation, uint32_t const durationMs, uint32_t const cycleMs) {
+    atoStation.setNormalLevelState(Level::Low);
+    loop(durationMs);
+    atoStation.setNormalLevelState(Level::High);
+    loop(cycleMs - durationMs);
+}
+
+static void shouldAggregateDispenseHistory() {
+    /* given */
+    AtoDispenseHistory history{};
+
+    /* when */
+    history.record(5000, 20ul * 60000ul);
+    history.record(7000, 40ul * 60000ul);
+    history.record(9000, 30ul * 1000ul); // <- under a minute, ignored
+
+    /* then */
+    assert(history.size() == 2);
+    assert(history.getTotalDurationMs() == 12000);
+    assert(history.getTotalIntervalMinutes() == 60);
+    assert(history.getLongestDurationMs() == 7000);
+    assert(history.getPumpMsPerHour() == 12000);
+    assert(history.getEvaporationMlPerDay(1000) == 4800);
+    assert(history.getIntervalForDurationMs(24000) == 120ul * 60000ul);
+    assert(history.getDurationForIntervalMs(30ul * 60000ul) == 6000);
+
+    std::cout << "ok -> shouldAggregateDispenseHistory\n";
+}
+
+static void shouldDropOldestSampleWhenFull() {
+    /* given */
+    AtoDispenseHistory history{};
+    for (uint8_t i = 0; i < AtoDispenseHistory::capacity; ++i) {
+        history.record(1000, 60000);
+    }
+
+    /* when */
+    history.record(9000, 60000);
+
+    /* then */
+    assert(history.size() == AtoDispenseHistory::capacity);
+    assert(history.getTotalDurationMs() == (AtoDispenseHistory::capacity - 1) * 1000ul + 9000ul);
+    assert(history.getLongestDurationMs() == 9000);
+
+    std::cout << "ok -> shouldDropOldestSampleWhenFull\n";
+}
+
+static void shouldUseFixedSettingsWhenNotAdaptive() {
+    /* given */
+    AtoSettings atoSettings = adaptiveSettings();
+    atoSettings.isAdaptive = false;
+    Switchable atoDispenser{};
+    AtoStation atoStation{atoSettings, atoDispenser};
+    AbstractRunnable::setupAll();
+    loop();
+
+    /* when */
+    for (uint8_t i = 0; i < 4; ++i) {
+        topOff(atoStation, 5000, 20ul * 60000ul);
+    }
+
+    /* then */
+    assert(atoStation.getDispenseHistory().size() == 3);
+    assert(atoStation.getDispensingIntervalMs() == atoSettings.minDispensingIntervalMs);
+    assert(atoStation.getMaxDispensingDurationMs() == atoSettings.maxDispensingDurationMs);
+
+    std::cout << "ok -> shouldUseFixedSettingsWhenNotAdaptive\n";
+}
+
+static void shouldAdaptIntervalAndMaxDurationToEvaporation() {
+    /* given */
+    AtoSettings atoSettings = adaptiveSettings();
+    Switchable atoDispenser{};
+    AtoStation atoStation{atoSettings, atoDispenser};
+    AbstractRunnable::setupAll();
+    loop();
+
+    /* when, 5 s of water every 20 min */
+    for (uint8_t i = 0; i < 4; ++i) {
+        topOff(atoStation, 5000, 20ul * 60000ul);
+    }
+
+    /* then, 15 s wanted -> every 60 min, expected 15 s -> fails at 30 s */
+    assert(atoStation.getDispenseHistory().size() == 3);
+    assert(atoStation.getDispensingIntervalMs() == 60ul * 60000ul);
+    assert(atoStation.getMaxDispensingDurationMs() == 30ul * 1000ul);
+
+    /* when, level drops 20 min after the last start */
+    atoStation.setNormalLevelState(Level::Low);
+    loop(40ul * 60000ul);
+
+    /* then, top-off waits for the learned interval */
+    assert(atoStation.isInState(AtoStationState::Sensing));
+    assert(atoDispenser.isInState(Switched::Off));
+    loop();
+    assert(atoStation.isInState(AtoStationState::Dispensing));
+
+    /* when, the pump does not refill within the derived time */
+    loop(30ul * 1000ul);
+
+    /* then */
+    assert(atoStation.isInState(AtoStationState::Alarming));
+    assert(atoDispenser.isInState(Switched::Off));
+
+    std::cout << "ok -> shouldAdaptIntervalAndMaxDurationToEvaporation\n";
+}
+
+static void shouldKeepAdaptedValuesWithinBounds() {
+    /* given */
+    AtoSettings atoSettings = adaptiveSettings();
+    Switchable atoDispenser{};
+    AtoStation atoStation{atoSettings, atoDispenser};
+    AbstractRunnable::setupAll();
+    loop();
+
+    /* when, 1 s of water every 30 min -> 7.5 h for 15 s */
+    for (uint8_t i = 0; i < 4; ++i) {
+        topOff(atoStation, 1000, 30ul * 60000ul);
+    }
+
+    /* then */
+    assert(atoStation.getDispensingIntervalMs() == atoSettings.maxDispensingIntervalMs);
+    assert(atoStation.getMaxDispensingDurationMs() == atoSettings.minDispensingDurationMs);
+
+    std::cout << "ok -> shouldKeepAdaptedValuesWithinBounds\n";
+}
+
+static void shouldNotSampleIntervalSpanningFailedTopOff() {
+    /* given, 5 s of water every 20 min -> every 60 min */
+    AtoSettings atoSettings = adaptiveSettings();
+    Switchable atoDispenser{};
+    AtoStation atoStation{atoSettings, atoDispenser};
+    AbstractRunnable::setupAll();
+    loop();
+    for (uint8_t i = 0; i < 4; ++i) {
+        topOff(atoStation, 5000, 20ul * 60000ul);
+    }
+    assert(atoStation.getDispenseHistory().getTotalIntervalMinutes() == 3 * 20);
+
+    /* when, the top-off times out and the level is restored by hand */
+    atoStation.setNormalLevelState(Level::Low);
+    loop(40ul * 60000ul + 1);
+    loop(30ul * 1000ul);
+    assert(atoStation.isInState(AtoStationState::Alarming));
+    atoStation.setNormalLevelState(Level::High);
+    loop();
+    assert(atoStation.isInState(AtoStationState::Sensing));
+
+    /* when, the next two top-offs end normally */
+    for (uint8_t i = 0; i < 2; ++i) {
+        atoStation.setNormalLevelState(Level::Low);
+        while (!atoStation.isInState(AtoStationState::Dispensing)) {
+            loop();
+        }
+        loop(5000);
+        atoStation.setNormalLevelState(Level::High);
+        loop();
+    }
+
+    /* then, only the interval between the two is sampled */
+    assert(atoStation.getDispenseHistory().size() == 4);
+    assert(atoStation.getDispenseHistory().getTotalIntervalMinutes() == 3 * 20 + 60);
+
+    std::cout << "ok -> shouldNotSampleIntervalSpanningFailedTopOff\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldAggregateDispenseHistory();
+        shouldDropOldestSampleWhenFull();
+        shouldUseFixedSettingsWhenNotAdaptive();
+        shouldAdaptIntervalAndMaxDurationToEvaporation();
+        shouldKeepAdaptedValuesWithinBounds();
+        shouldNotSampleIntervalSpanningFailedTopOff();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
@@ -0,0 +1,191 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include "../_Mocks/MockCommon.h"
+
+#include <Enums/AtoDispenseEnd.h>
+#include <Enums/Level.h>
+
+#include <AtoStation/AtoDispenseJournal.h>
+#include <AtoStation/AtoStation.h>
+#include <Common/Switchable.h>
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static void loop(uint32_t forwardMs) {
+    for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+        loop();
+    }
+}
+
+static std::vector<AtoDispenseJournalEntry> entriesOf(AtoDispenseJournal const &journal) {
+    std::vector<AtoDispenseJournalEntry> entries{};
+    journal.forEach([&entries](AtoDispenseJournalEntry const &entry) {
+        entries.push_back(entry);
+    });
+    return entries;
+}
+
+static void shouldRoundTripRecords() {
+    /* given */
+    AtoDispenseJournal journal{};
+
+    /* when */
+    journal.record(1500, 30000, AtoDispenseEnd::NormalLevel, Level::High);
+    journal.record(1500 + 20ul * 60000ul, 31240, AtoDispenseEnd::Timeout, Level::Low);
+    journal.record(UINT32_MAX - 999, 12345678, AtoDispenseEnd::HighLevel, Level::Unknown);
+
+    /* then */
+    std::vector<AtoDispenseJournalEntry> entries = entriesOf(journal);
+    assert(journal.size() == 3);
+    assert(entries.size() == 3);
+
+    assert(entries[0].startS == 1);
+    assert(entries[0].durationDs == 300);
+    assert(entries[0].reason == AtoDispenseEnd::NormalLevel);
+    assert(entries[0].reservoirLevel == Level::High);
+
+    assert(entries[1].startS == 1 + 20ul * 60ul);
+    assert(entries[1].durationDs == 312);
+    assert(entries[1].reason == AtoDispenseEnd::Timeout);
+    assert(entries[1].reservoirLevel == Level::Low);
+
+    assert(entries[2].startS == (UINT32_MAX - 999) / 1000ul);
+    assert(entries[2].durationDs == 123457);
+    assert(entries[2].reason == AtoDispenseEnd::HighLevel);
+    assert(entries[2].reservoirLevel == Level::Unknown);
+
+    std::cout << "ok -> shouldRoundTripRecords\n";
+}
+
+static void shouldPackUsualTopOffInFiveBytes() {
+    /* given */
+    AtoDispenseJournal journal{};
+    journal.record(0, 30000, AtoDispenseEnd::NormalLevel, Level::High);
+    uint8_t firstBytes = journal.getByteCount();
+
+    /* when, 30 s every 20 min */
+    journal.record(20ul * 60000ul, 30000, AtoDispenseEnd::NormalLevel, Level::High);
+
+    /* then */
+    assert(firstBytes == 4);
+    assert(journal.getByteCount() - firstBytes == 5);
+
+    std::cout << "ok -> shouldPackUsualTopOffInFiveBytes\n";
+}
+
+static void shouldDropOldestRecordsWhenFull() {
+    /* given */
+    AtoDispenseJournal journal{};
+    uint32_t const cycleMs = 20ul * 60000ul;
+    uint16_t const recordCount = 3 * AtoDispenseJournal::capacity / 5;
+
+    /* when */
+    for (uint16_t index = 0; index < recordCount; ++index) {
+        journal.record(index * cycleMs, 1000ul * index, AtoDispenseEnd::NormalLevel, Level::High);
+    }
+
+    /* then, the newest records are kept with their absolute start */
+    std::vector<AtoDispenseJournalEntry> entries = entriesOf(journal);
+    assert(journal.getByteCount() <= AtoDispenseJournal::capacity);
+    assert(journal.size() == entries.size());
+    assert(journal.size() < recordCount);
+
+    uint16_t firstIndex = static_cast<uint16_t>(recordCount - entries.size());
+    for (uint16_t index = 0; index < entries.size(); ++index) {
+        assert(entries[index].startS == (firstIndex + index) * cycleMs / 1000ul);
+        assert(entries[index].durationDs == 10ul * (firstIndex + index));
+    }
+
+    std::cout << "ok -> shouldDropOldestRecordsWhenFull\n";
+}
+
+static void shouldJournalEveryDispenseEnd() {
+    /* given */
+    AtoSettings atoSettings{1000, 60000};
+    Switchable atoDispenser{};
+    AtoStation atoStation{atoSettings, atoDispenser};
+    AbstractRunnable::setupAll();
+    atoStation.setReservoirLevelState(Level::High);
+    atoStation.setHighLevelState(Level::Low);
+    atoStation.setLowLevelState(Level::High);
+    loop();
+
+    /* when, normal level reached after 5 s */
+    atoStation.setNormalLevelState(Level::Low);
+    loop(5000);
+    atoStation.setNormalLevelState(Level::High);
+    loop(2000);
+
+    /* when, high level after 3 s */
+    atoStation.setNormalLevelState(Level::Low);
+    loop(3000);
+    atoStation.setHighLevelState(Level::High);
+    loop(2);
+    atoStation.setHighLevelState(Level::Low);
+    loop(2000);
+
+    /* when, sleeping while dispensing */
+    loop(1000);
+    assert(atoStation.isInState(AtoStationState::Dispensing));
+    atoStation.startSleeping(1000);
+    loop(3000);
+
+    /* when, top-off failed */
+    assert(atoStation.isInState(AtoStationState::Dispensing));
+    loop(60001);
+
+    /* then */
+    std::vector<AtoDispenseJournalEntry> entries = entriesOf(atoStation.getDispenseJournal());
+    assert(entries.size() == 4);
+    assert(entries[0].reason == AtoDispenseEnd::NormalLevel);
+    assert(entries[0].durationDs == 50);
+    assert(entries[1].reason == AtoDispenseEnd::HighLevel);
+    assert(entries[1].durationDs == 30);
+    assert(entries[2].reason == AtoDispenseEnd::Sleep);
+    assert(entries[3].reason == AtoDispenseEnd::Timeout);
+    assert(entries[3].durationDs == 600);
+    assert(entries[3].reservoirLevel == Level::High);
+
+    std::cout << "ok -> shouldJournalEveryDispenseEnd\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldRoundTripRecords();
+        shouldPackUsualTopOffInFiveBytes();
+        shouldDropOldestRecordsWhenFull();
+        shouldJournalEveryDispenseEnd();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
@@ -0,0 +1,303 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+
+#include "../_Mocks/MockCommon.h"
+
+#include <Enums/AlarmCode.h>
+#include <Enums/AtoLevelChannel.h>
+#include <Enums/Level.h>
+
+#include <AtoStation/AbstractAtoLevelBank.h>
+#include <AtoStation/AtoAlarmCodes.h>
+#include <AtoStation/AtoPowerArbiter.h>
+#include <AtoStation/AtoStation.h>
+
+#include <AlarmStation/AlarmStation.h>
+#include <Common/Switchable.h>
+
+#include "../_Mocks/MockBuzzer.h"
+
+static LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> alarmNotifyConfigurations{};
+
+/**
+ * <br/>
+ * Sensor bits set by the test, counts the scans.
+ */
+class MockAtoLevelBank :
+        public AbstractAtoLevelBank {
+
+public:
+
+    uint32_t inputs = 0;
+    uint32_t readCount = 0;
+
+    void setup() override {}
+
+    void setBit(uint8_t const bit, bool const isSet) {
+        inputs = isSet ? inputs | (1ul << bit) : inputs & ~(1ul << bit);
+    }
+
+protected:
+
+    uint32_t readInputs() override {
+        ++readCount;
+        return inputs;
+    }
+};
+
+namespace Bit {
+    constexpr uint8_t Reservoir = 0;
+    constexpr uint8_t SumpNormal = 1;
+    constexpr uint8_t SumpHigh = 2;
+    constexpr uint8_t SumpLow = 3;
+    constexpr uint8_t FragNormal = 4;
+    constexpr uint8_t FragHigh = 5;
+    constexpr uint8_t FragLow = 6;
+}
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static void loop(uint32_t forwardMs) {
+    for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+        loop();
+    }
+}
+
+static void connect(MockAtoLevelBank &bank, AtoStation &sumpAtoStation, AtoStation &fragAtoStation) {
+    bank.connect(Bit::Reservoir, sumpAtoStation, AtoLevelChannel::Reservoir);
+    bank.connect(Bit::Reservoir, fragAtoStation, AtoLevelChannel::Reservoir);
+    bank.connect(Bit::SumpNormal, sumpAtoStation, AtoLevelChannel::Normal);
+    bank.connect(Bit::SumpHigh, sumpAtoStation, AtoLevelChannel::High);
+    bank.connect(Bit::SumpLow, sumpAtoStation, AtoLevelChannel::Low);
+    bank.connect(Bit::FragNormal, fragAtoStation, AtoLevelChannel::Normal);
+    bank.connect(Bit::FragHigh, fragAtoStation, AtoLevelChannel::High);
+    bank.connect(Bit::FragLow, fragAtoStation, AtoLevelChannel::Low);
+
+    /* full reservoir, both tanks at level */
+    bank.setBit(Bit::Reservoir, true);
+    bank.setBit(Bit::SumpNormal, true);
+    bank.setBit(Bit::SumpLow, true);
+    bank.setBit(Bit::FragNormal, true);
+    bank.setBit(Bit::FragLow, true);
+}
+
+static void shouldGiveEveryStationItsOwnAlarmCodes() {
+    /* given */
+    AtoAlarmCodes first = AtoAlarmCodes::forStation<0>();
+    AtoAlarmCodes second = AtoAlarmCodes::forStation<1>();
+    AtoAlarmCodes fourth = AtoAlarmCodes::forStation<3>();
+
+    /* then */
+    assert(first.topOffFailed == AlarmCode::AtoTopOffFailed);
+    assert(first.highLevel == AlarmCode::AtoHighLevel);
+    assert(first.lowLevel == AlarmCode::AtoLowLevel);
+    assert(second.topOffFailed == AlarmCode::Ato2TopOffFailed);
+    assert(second.highLevel == AlarmCode::Ato2HighLevel);
+    assert(second.lowLevel == AlarmCode::Ato2LowLevel);
+    assert(fourth.topOffFailed == AlarmCode::Ato4TopOffFailed);
+    assert(fourth.lowLevel == AlarmCode::Ato4LowLevel);
+    // AtoAlarmCodes::forStation<4>() does not compile, a fifth station would raise no level alarms
+    assert(second.reservoirLow == AlarmCode::AtoReservoirLow);
+    assert(static_cast<uint8_t>(AlarmCode::Ato4LowLevel) < 32); // <- fits the reported alarm mask
+
+    std::cout << "ok -> shouldGiveEveryStationItsOwnAlarmCodes\n";
+}
+
+static void shouldScanAllSensorsOnceAndForwardChangesOnly() {
+    /* given */
+    AtoSettings atoSettings{};
+    Switchable sumpDispenser{};
+    Switchable fragDispenser{};
+    MockAtoLevelBank bank{};
+    AtoStation sumpAtoStation{atoSettings, sumpDispenser, AtoAlarmCodes::forStation<0>()};
+    AtoStation fragAtoStation{atoSettings, fragDispenser, AtoAlarmCodes::forStation<1>()};
+    connect(bank, sumpAtoStation, fragAtoStation);
+    AbstractRunnable::setupAll();
+
+    /* when */
+    loop(100);
+
+    /* then, one read per loop for both stations */
+    assert(bank.readCount == 100);
+    assert(sumpAtoStation.isInState(AtoStationState::Sensing));
+    assert(fragAtoStation.isInState(AtoStationState::Sensing));
+    assert(!sumpAtoStation.getStateMachine().hasPendingEvents());
+    assert(!fragAtoStation.getStateMachine().hasPendingEvents());
+
+    /* when, frag tank level drops */
+    bank.setBit(Bit::FragNormal, false);
+    loop(2);
+
+    /* then */
+    assert(sumpAtoStation.isInState(AtoStationState::Sensing));
+    assert(fragAtoStation.isInState(AtoStationState::Dispensing));
+    assert(fragDispenser.isInState(Switched::On));
+    assert(sumpDispenser.isInState(Switched::Off));
+
+    std::cout << "ok -> shouldScanAllSensorsOnceAndForwardChangesOnly\n";
+}
+
+static void shouldRaiseAlarmsWithStationCodes() {
+    /* given */
+    AtoSettings atoSettings{};
+    Switchable sumpDispenser{};
+    Switchable fragDispenser{};
+    MockAtoLevelBank bank{};
+    MockBuzzer buzzer{};
+    AlarmStation alarmStation{buzzer, alarmNotifyConfigurations};
+    AtoStation sumpAtoStation{atoSettings, sumpDispenser, AtoAlarmCodes::forStation<0>()};
+    AtoStation fragAtoStation{atoSettings, fragDispenser, AtoAlarmCodes::forStation<1>()};
+    sumpAtoStation.attachAlarmStation(&alarmStation);
+    fragAtoStation.attachAlarmStation(&alarmStation);
+    connect(bank, sumpAtoStation, fragAtoStation);
+    AbstractRunnable::setupAll();
+    loop(10);
+
+    /* when */
+    bank.setBit(Bit::FragHigh, true);
+    loop(3);
+
+    /* then */
+    assert(fragAtoStation.isInState(AtoStationState::Alarming));
+    assert(sumpAtoStation.isInState(AtoStationState::Sensing));
+    assert(alarmStation.alarmList.contains(AlarmCode::Ato2HighLevel));
+    assert(!alarmStation.alarmList.contains(AlarmCode::AtoHighLevel));
+
+    /* when, sleeping the sump does not delete the frag alarm */
+    sumpAtoStation.startSleeping(1000);
+    loop();
+
+    /* then */
+    assert(alarmStation.alarmList.contains(AlarmCode::Ato2HighLevel));
+
+    std::cout << "ok -> shouldRaiseAlarmsWithStationCodes\n";
+}
+
+static void shouldHoldAllStationsWithOneSharedReservoirAlarm() {
+    /* given */
+    AtoSettings atoSettings{};
+    Switchable sumpDispenser{};
+    Switchable fragDispenser{};
+    MockAtoLevelBank bank{};
+    MockBuzzer buzzer{};
+    AlarmStation alarmStation{buzzer, alarmNotifyConfigurations};
+    AtoStation sumpAtoStation{atoSettings, sumpDispenser, AtoAlarmCodes::forStation<0>()};
+    AtoStation fragAtoStation{atoSettings, fragDispenser, AtoAlarmCodes::forStation<1>()};
+    sumpAtoStation.attachAlarmStation(&alarmStation);
+    fragAtoStation.attachAlarmStation(&alarmStation);
+    connect(bank, sumpAtoStation, fragAtoStation);
+    AbstractRunnable::setupAll();
+    loop(10);
+
+    /* when */
+    bank.setBit(Bit::Reservoir, false);
+    bank.setBit(Bit::SumpNormal, false);
+    loop(3);
+
+    /* then */
+    assert(sumpAtoStation.isInState(AtoStationState::Alarming));
+    assert(fragAtoStation.isInState(AtoStationState::Alarming));
+    assert(sumpDispenser.isInState(Switched::Off));
+    assert(alarmStation.alarmList.size() == 1);
+    assert(alarmStation.alarmList.contains(AlarmCode::AtoReservoirLow));
+
+    /* when, refilled */
+    bank.setBit(Bit::Reservoir, true);
+    loop(3);
+
+    /* then */
+    assert(alarmStation.alarmList.isAcknowledged(AlarmCode::AtoReservoirLow));
+    assert(fragAtoStation.isInState(AtoStationState::Sensing));
+
+    std::cout << "ok -> shouldHoldAllStationsWithOneSharedReservoirAlarm\n";
+}
+
+static void shouldRunOneDispenserAtATimeOnSharedPower() {
+    /* given */
+    AtoSettings atoSettings{60000, 90000};
+    Switchable sumpDispenser{};
+    Switchable fragDispenser{};
+    MockAtoLevelBank bank{};
+    AtoPowerArbiter powerArbiter{1};
+    AtoStation sumpAtoStation{atoSettings, sumpDispenser, AtoAlarmCodes::forStation<0>()};
+    AtoStation fragAtoStation{atoSettings, fragDispenser, AtoAlarmCodes::forStation<1>()};
+    sumpAtoStation.attachPowerArbiter(&powerArbiter);
+    fragAtoStation.attachPowerArbiter(&powerArbiter);
+    connect(bank, sumpAtoStation, fragAtoStation);
+    AbstractRunnable::setupAll();
+    loop(10);
+
+    /* when, both levels drop */
+    bank.setBit(Bit::SumpNormal, false);
+    bank.setBit(Bit::FragNormal, false);
+    loop(2);
+
+    /* then, one runs, the other waits */
+    assert(powerArbiter.getRunningCount() == 1);
+    assert(sumpDispenser.isInState(Switched::On) != fragDispenser.isInState(Switched::On));
+    Switchable &firstDispenser = sumpDispenser.isInState(Switched::On) ? sumpDispenser : fragDispenser;
+    Switchable &secondDispenser = sumpDispenser.isInState(Switched::On) ? fragDispenser : sumpDispenser;
+    uint8_t firstNormalBit = sumpDispenser.isInState(Switched::On) ? Bit::SumpNormal : Bit::FragNormal;
+
+    loop(5000);
+    assert(secondDispenser.isInState(Switched::Off));
+
+    /* when, first tank at level */
+    bank.setBit(firstNormalBit, true);
+    loop(3);
+
+    /* then, the waiting one takes over */
+    assert(firstDispenser.isInState(Switched::Off));
+    assert(secondDispenser.isInState(Switched::On));
+    assert(powerArbiter.getRunningCount() == 1);
+
+    /* when, first tank drops again within its interval */
+    bank.setBit(firstNormalBit, false);
+    loop(3);
+
+    /* then */
+    assert(firstDispenser.isInState(Switched::Off));
+    assert(powerArbiter.getRunningCount() == 1);
+
+    std::cout << "ok -> shouldRunOneDispenserAtATimeOnSharedPower\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldGiveEveryStationItsOwnAlarmCodes();
+        shouldScanAllSensorsOnceAndForwardChangesOnly();
+        shouldRaiseAlarmsWithStationCodes();
+        shouldHoldAllStationsWithOneSharedReservoirAlarm();
+        shouldRunOneDispenserAtATimeOnSharedPower();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
@@ -0,0 +1,301 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+
+#include "../_Mocks/MockCommon.h"
+
+#include <Enums/AlarmCode.h>
+#include <Enums/Level.h>
+
+#include <AtoStation/AtoStation.h>
+#include <AlarmStation/AlarmStation.h>
+#include <Common/Switchable.h>
+
+#include "../_Mocks/MockBuzzer.h"
+
+static AtoSettings atoSettings{2000, 500};
+static LinkedMap<AlarmSeverity, AlarmNotifyConfiguration> alarmNotifyConfigurations{};
+static MockBuzzer buzzer{};
+static bool isTransitionCovered[16] = {};
+
+static const Level levels[] = {Level::Low, Level::High, Level::Unknown};
+
+struct Fixture {
+    Switchable atoDispenser{};
+    AlarmStation alarmStation{buzzer, alarmNotifyConfigurations};
+    AtoStation atoStation{atoSettings, atoDispenser};
+
+    Fixture() {
+        atoStation.attachAlarmStation(&alarmStation);
+        AbstractRunnable::setupAll();
+        Fixture::loop();
+    }
+
+    void loop() {
+        AbstractRunnable::loopAll();
+        uint8_t transition = atoStation.getStateMachine().getLastTransition();
+        if (transition != AtoStation::Machine::noTransition) {
+            isTransitionCovered[transition] = true;
+        }
+    }
+
+    void loop(uint32_t forwardMs) {
+        for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+            Fixture::loop();
+        }
+    }
+
+    void setLevels(Level const normal, Level const high, Level const low, Level const reservoir) {
+        atoStation.setNormalLevelState(normal);
+        atoStation.setHighLevelState(high);
+        atoStation.setLowLevelState(low);
+        atoStation.setReservoirLevelState(reservoir);
+    }
+};
+
+/**
+ * <br/>
+ * Reference behaviour, one evaluation of the former switch based <tt>AtoStation::loop</tt>, timers not elapsed.
+ */
+static AtoStationState expectedNextState(AtoStationState const state, bool const hasTopOffFailed,
+                                         Level const normal, Level const high, Level const low, Level const reservoir) {
+    switch (state) {
+        case AtoStationState::Sensing:
+            if (reservoir == Level::Low || high == Level::High || low == Level::Low) {
+                return AtoStationState::Alarming;
+            }
+            return normal == Level::Low ? AtoStationState::Dispensing : AtoStationState::Sensing;
+
+        case AtoStationState::Dispensing:
+            if (high == Level::High || low == Level::Low) {
+                return AtoStationState::Alarming;
+            }
+            return normal == Level::High ? AtoStationState::Sensing : AtoStationState::Dispensing;
+
+        case AtoStationState::Alarming:
+            if (high != Level::High && low != Level::Low && reservoir != Level::Low && (normal == Level::High || !hasTopOffFailed)) {
+                return AtoStationState::Sensing;
+            }
+            return AtoStationState::Alarming;
+
+        default:
+            return state;
+    }
+}
+
+/**
+ * <br/>
+ * Brings a fresh station into <tt>state</tt> along the shortest path.
+ */
+static void enterState(Fixture &fixture, AtoStationState const state, bool const hasTopOffFailed) {
+    switch (state) {
+        case AtoStationState::Dispensing:
+            fixture.atoStation.setNormalLevelState(Level::Low);
+            fixture.loop();
+            break;
+
+        case AtoStationState::Alarming:
+            if (hasTopOffFailed) {
+                fixture.atoStation.setNormalLevelState(Level::Low);
+                fixture.loop();
+                fixture.loop(atoSettings.maxDispensingDurationMs);
+            } else {
+                fixture.atoStation.setReservoirLevelState(Level::Low);
+                fixture.loop();
+            }
+            break;
+
+        case AtoStationState::Sleeping:
+            fixture.atoStation.startSleeping(300000);
+            fixture.loop();
+            break;
+
+        default:
+            break;
+    }
+    assert(fixture.atoStation.isInState(state));
+}
+
+static void shouldFollowReferenceForEveryStateAndLevelCombination() {
+    struct StartState {
+        AtoStationState state;
+        bool hasTopOffFailed;
+    };
+    const StartState startStates[] = {
+            {AtoStationState::Sensing,    false},
+            {AtoStationState::Dispensing, false},
+            {AtoStationState::Alarming,   false},
+            {AtoStationState::Alarming,   true},
+            {AtoStationState::Sleeping,   false},
+    };
+
+    uint16_t caseCount = 0;
+    for (StartState const &startState : startStates) {
+        for (Level normal : levels) {
+            for (Level high : levels) {
+                for (Level low : levels) {
+                    for (Level reservoir : levels) {
+                        /* given */
+                        Fixture fixture{};
+                        enterState(fixture, startState.state, startState.hasTopOffFailed);
+
+                        /* when */
+                        fixture.setLevels(normal, high, low, reservoir);
+                        fixture.loop();
+
+                        /* then */
+                        AtoStationState expected = expectedNextState(
+                                startState.state, startState.hasTopOffFailed, normal, high, low, reservoir);
+                        assert(fixture.atoStation.isInState(expected));
+                        assert(fixture.atoDispenser.isInState(
+                                expected == AtoStationState::Dispensing ? Switched::On : Switched::Off));
+
+                        if (expected == AtoStationState::Alarming && startState.state != AtoStationState::Alarming) {
+                            /* entry evaluation raises the remaining level alarms */
+                            fixture.loop();
+                            assert(fixture.atoStation.isInState(AtoStationState::Alarming));
+                            assert(reservoir != Level::Low || fixture.alarmStation.alarmList.contains(AlarmCode::AtoReservoirLow));
+                            assert(high != Level::High || fixture.alarmStation.alarmList.contains(AlarmCode::AtoHighLevel));
+                            assert(low != Level::Low || fixture.alarmStation.alarmList.contains(AlarmCode::AtoLowLevel));
+                        }
+                        if (startState.state == AtoStationState::Sleeping) {
+                            assert(fixture.alarmStation.alarmList.isEmpty());
+                        }
+                        ++caseCount;
+                    }
+                }
+            }
+        }
+    }
+    assert(caseCount == 5 * 81);
+
+    std::cout << "ok -> shouldFollowReferenceForEveryStateAndLevelCombination\n";
+}
+
+static void shouldStopDispensingOnTimerWhenDurationElapsed() {
+    /* given */
+    Fixture fixture{};
+    fixture.atoStation.setNormalLevelState(Level::Low);
+    fixture.loop();
+    assert(fixture.atoStation.isInState(AtoStationState::Dispensing));
+
+    /* when */
+    fixture.loop(atoSettings.maxDispensingDurationMs - 1);
+
+    /* then */
+    assert(fixture.atoStation.isInState(AtoStationState::Dispensing));
+    fixture.loop();
+    assert(fixture.atoStation.isInState(AtoStationState::Alarming));
+    assert(fixture.atoDispenser.isInState(Switched::Off));
+    assert(fixture.alarmStation.alarmList.contains(AlarmCode::AtoTopOffFailed));
+
+    std::cout << "ok -> shouldStopDispensingOnTimerWhenDurationElapsed\n";
+}
+
+static void shouldStartDispensingOnTimerWhenIntervalElapsed() {
+    /* given */
+    Fixture fixture{};
+    fixture.atoStation.setNormalLevelState(Level::Low);
+    fixture.loop();
+    assert(fixture.atoStation.isInState(AtoStationState::Dispensing));
+    fixture.atoStation.setNormalLevelState(Level::High);
+    fixture.loop();
+    assert(fixture.atoStation.isInState(AtoStationState::Sensing));
+
+    /* when */
+    fixture.atoStation.setNormalLevelState(Level::Low);
+    fixture.loop(atoSettings.minDispensingIntervalMs - 2);
+
+    /* then, dispensing started one interval after the previous start */
+    assert(fixture.atoStation.isInState(AtoStationState::Sensing));
+    fixture.loop();
+    assert(fixture.atoStation.isInState(AtoStationState::Dispensing));
+
+    std::cout << "ok -> shouldStartDispensingOnTimerWhenIntervalElapsed\n";
+}
+
+static void shouldWakeUpOnTimerWhenSleepElapsed() {
+    /* given */
+    Fixture fixture{};
+    fixture.atoStation.startSleeping(1000);
+    fixture.loop();
+
+    /* when */
+    fixture.loop(999);
+
+    /* then */
+    assert(fixture.atoStation.isInState(AtoStationState::Sleeping));
+    fixture.loop();
+    assert(fixture.atoStation.isInState(AtoStationState::Sensing));
+    assert(!fixture.atoStation.isSleeping());
+
+    std::cout << "ok -> shouldWakeUpOnTimerWhenSleepElapsed\n";
+}
+
+static void shouldNotDispatchWithoutEvents() {
+    /* given */
+    Fixture fixture{};
+    fixture.atoStation.setReservoirLevelState(Level::Low);
+    fixture.loop();
+    assert(fixture.atoStation.isInState(AtoStationState::Alarming));
+    fixture.loop();
+    fixture.alarmStation.alarmList.acknowledge(AlarmCode::AtoReservoirLow);
+
+    /* when */
+    fixture.atoStation.setReservoirLevelState(Level::Low);
+    fixture.loop(100);
+
+    /* then, unchanged level posts nothing, the acknowledged alarm stays acknowledged */
+    assert(!fixture.atoStation.getStateMachine().hasPendingEvents());
+    assert(fixture.alarmStation.alarmList.isAcknowledged(AlarmCode::AtoReservoirLow));
+
+    std::cout << "ok -> shouldNotDispatchWithoutEvents\n";
+}
+
+static void shouldCoverEveryTransition() {
+    /* then */
+    uint8_t transitionCount = Fixture{}.atoStation.getStateMachine().getTransitionCount();
+    for (uint8_t index = 0; index < transitionCount; ++index) {
+        assert(isTransitionCovered[index]);
+    }
+
+    std::cout << "ok -> shouldCoverEveryTransition\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldFollowReferenceForEveryStateAndLevelCombination();
+        shouldStopDispensingOnTimerWhenDurationElapsed();
+        shouldStartDispensingOnTimerWhenIntervalElapsed();
+        shouldWakeUpOnTimerWhenSleepElapsed();
+        shouldNotDispatchWithoutEvents();
+        shouldCoverEveryTransition();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
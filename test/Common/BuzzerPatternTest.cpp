@@ -0,0 +1,168 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+
+#include "../_Mocks/MockCommon.h"
+
+#include <Abstract/AbstractRunnable.h>
+#include <Common/BuzzerPattern.h>
+
+#include "../_Mocks/MockBuzzer.h"
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static void loop(uint32_t forwardMs) {
+    for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+        loop();
+    }
+}
+
+static uint8_t countOnSteps(BuzzerPattern const &pattern) {
+    uint8_t onSteps = 0;
+    for (uint8_t step = 0; step < pattern.getLength(); ++step) {
+        onSteps += pattern.isOn(step) ? 1 : 0;
+    }
+    return onSteps;
+}
+
+static void shouldEncodeAlarmIdentity() {
+    /* when */
+    BuzzerPattern highLevel = BuzzerPattern::forAlarm(AlarmCode::AtoHighLevel, AlarmSeverity::Major);
+    BuzzerPattern ato4LowLevel = BuzzerPattern::forAlarm(AlarmCode::Ato4LowLevel, AlarmSeverity::Critical);
+    BuzzerPattern none = BuzzerPattern::forAlarm(AlarmCode::NoAlarm, AlarmSeverity::NoSeverity);
+
+    /* then, 4 steps tone, 2 pause, 8 short beeps */
+    assert(highLevel.getLength() == 4 + 2 + 8 * 2);
+    assert((highLevel.getBits() & 0x3Ful) == 0x0Ful);
+    assert(countOnSteps(highLevel) == 4 + 8);
+
+    /* then, 6 steps tone, 2 pause, one ten, pause, 8 short beeps */
+    assert(ato4LowLevel.getLength() == 6 + 2 + 4 + 1 + 8 * 2);
+    assert(countOnSteps(ato4LowLevel) == 6 + 3 + 8);
+    assert(ato4LowLevel.getLength() <= BuzzerPattern::maxLength);
+
+    assert(none.isEmpty());
+
+    std::cout << "ok -> shouldEncodeAlarmIdentity\n";
+}
+
+static void shouldPlayPatternWithoutBlocking() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    BuzzerPattern pattern{};
+    pattern.append(2, 1).append(1, 1); // <- 200 ms on, 100 ms off, 100 ms on, 100 ms off
+
+    /* when */
+    assert(mockBuzzer.play(pattern, 1));
+    uint32_t onMs = 0;
+    uint8_t switchedOnCount = 0;
+    Switched lastState = mockBuzzer.getState();
+    for (uint32_t ms = 0; ms <= 5 * BUZZER_PATTERN_STEP_MS; ++ms) {
+        loop();
+        onMs += mockBuzzer.isInState(Switched::On) ? 1 : 0;
+        if (mockBuzzer.getState() != lastState) {
+            lastState = mockBuzzer.getState();
+            switchedOnCount += mockBuzzer.isInState(Switched::On) ? 1 : 0;
+        }
+    }
+
+    /* then */
+    assert(onMs == 3 * BUZZER_PATTERN_STEP_MS);
+    assert(switchedOnCount == 1); // <- the second beep, play() switched on the first
+    assert(!mockBuzzer.isPlaying());
+    assert(mockBuzzer.isBusy()); // <- resting
+
+    /* when */
+    loop(1000);
+
+    /* then */
+    assert(!mockBuzzer.isBusy());
+    assert(mockBuzzer.isInState(Switched::Off));
+
+    std::cout << "ok -> shouldPlayPatternWithoutBlocking\n";
+}
+
+static void shouldPreemptOnlyWithHigherPriority() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    BuzzerPattern minor = BuzzerPattern::forAlarm(AlarmCode::AtoLowLevel, AlarmSeverity::Minor);
+    BuzzerPattern critical = BuzzerPattern::forAlarm(AlarmCode::SystemMaxTemperatureReached, AlarmSeverity::Critical);
+    assert(mockBuzzer.play(minor, 1));
+    loop(3 * BUZZER_PATTERN_STEP_MS);
+
+    /* when & then */
+    assert(!mockBuzzer.play(minor, 1));
+    assert(mockBuzzer.play(critical, 3));
+    assert(mockBuzzer.getPriority() == 3);
+    assert(mockBuzzer.isInState(Switched::On));
+
+    /* when, resting after the critical pattern */
+    loop(critical.getLength() * BUZZER_PATTERN_STEP_MS + 1);
+
+    /* then */
+    assert(!mockBuzzer.isPlaying());
+    assert(!mockBuzzer.play(minor, 1));
+
+    /* when */
+    loop(1000);
+
+    /* then */
+    assert(mockBuzzer.getPriority() == 0);
+    assert(mockBuzzer.play(minor, 1));
+
+    std::cout << "ok -> shouldPreemptOnlyWithHigherPriority\n";
+}
+
+static void shouldPreemptContinuousBuzz() {
+    /* given */
+    MockBuzzer mockBuzzer{1000};
+    assert(mockBuzzer.buzz(5000));
+    loop(100);
+
+    /* when */
+    bool isPlayed = mockBuzzer.play(BuzzerPattern::forAlarm(AlarmCode::AtoLowLevel, AlarmSeverity::Minor), 1);
+
+    /* then */
+    assert(isPlayed);
+    assert(mockBuzzer.isPlaying());
+
+    std::cout << "ok -> shouldPreemptContinuousBuzz\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldEncodeAlarmIdentity();
+        shouldPlayPatternWithoutBlocking();
+        shouldPreemptOnlyWithHigherPriority();
+        shouldPreemptContinuousBuzz();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <cassert>
+#include <iostream>
+#include <chrono>
+
+#include <Common/Centi.h>
+
+static void shouldCreateFromRawWholeAndFloat() {
+    /* given */
+    constexpr Centi fromRaw = Centi::fromRaw(2440);
+    constexpr Centi fromWhole = Centi::fromWhole(24);
+    constexpr Centi fromFloat = Centi::fromFloat(24.4f);
+
+    /* then */
+    static_assert(fromRaw.getRaw() == 2440, "constexpr fromRaw");
+    static_assert(fromWhole.getRaw() == 2400, "constexpr fromWhole");
+    static_assert(fromFloat.getRaw() == 2440, "constexpr fromFloat");
+    assert(fromFloat == fromRaw);
+
+    std::cout << "ok -> shouldCreateFromRawWholeAndFloat\n";
+}
+
+static void shouldRoundFloatToNearestHundredth() {
+    /* then */
+    assert(Centi::fromFloat(0.004f).getRaw() == 0);
+    assert(Centi::fromFloat(0.006f).getRaw() == 1);
+    assert(Centi::fromFloat(-0.006f).getRaw() == -1);
+    assert(Centi::fromFloat(-100.0f).getRaw() == -10000);
+    assert(Centi::fromFloat(25.6f).getRaw() == 2560);
+
+    std::cout << "ok -> shouldRoundFloatToNearestHundredth\n";
+}
+
+static void shouldCompareValues() {
+    /* given */
+    Centi low = Centi::fromFloat(22.0f);
+    Centi high = Centi::fromFloat(28.0f);
+
+    /* then */
+    assert(low < high);
+    assert(low <= high);
+    assert(high > low);
+    assert(high >= low);
+    assert(low != high);
+    assert(low == Centi::fromWhole(22));
+    assert(Centi::fromWhole(-1) < Centi());
+
+    std::cout << "ok -> shouldCompareValues\n";
+}
+
+static void shouldAddAndSubtractValues() {
+    /* given */
+    Centi value = Centi::fromFloat(24.4f);
+
+    /* when */
+    value += Centi::fromWhole(1);
+    value -= Centi::fromRaw(5);
+
+    /* then */
+    assert(value.getRaw() == 2535);
+    assert((value + Centi::fromRaw(5)).getRaw() == 2540);
+    assert((value - Centi::fromWhole(30)).getRaw() == -465);
+    assert((-value).getRaw() == -2535);
+    assert(value.toFloat() > 25.34f && value.toFloat() < 25.36f);
+
+    std::cout << "ok -> shouldAddAndSubtractValues\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldCreateFromRawWholeAndFloat();
+        shouldRoundFloatToNearestHundredth();
+        shouldCompareValues();
+        shouldAddAndSubtractValues();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
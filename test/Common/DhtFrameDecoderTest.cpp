@@ -0,0 +1,195 @@
+#include <cassert>
+#include <iostream>
+#include <chrono>
+
+#include <Common/DhtFrameDecoder.h>
+
+static void feedFrame(DhtFrameDecoder &decoder, uint8_t const (&frame)[5], uint16_t startUs) {
+    uint16_t us = startUs;
+    decoder.reset();
+
+    /* sensor response */
+    decoder.onFallingEdge(us);
+    us += 160;
+    decoder.onFallingEdge(us);
+
+    /* 40 bits, MSB first */
+    for (uint8_t bit = 0; bit < 40; ++bit) {
+        bool isOne = (frame[bit / 8] >> (7 - bit % 8)) & 1u;
+        us += isOne ? 120 : 78;
+        decoder.onFallingEdge(us);
+    }
+}
+
+static void shouldDecodeDht22Frame() {
+    /* given */
+    DhtFrameDecoder decoder{};
+    /* 65.2 %, 35.1 °C */
+    uint8_t frame[5] = {0x02, 0x8C, 0x01, 0x5F, 0xEE};
+
+    /* when */
+    feedFrame(decoder, frame, 1000);
+
+    /* then */
+    assert(decoder.isComplete());
+    assert(decoder.decode() == DhtReadStatus::Ok);
+    assert(decoder.getHumidityDeci(DhtModel::Dht22) == 652);
+    assert(decoder.getTemperatureDeci(DhtModel::Dht22) == 351);
+
+    std::cout << "ok -> shouldDecodeDht22Frame\n";
+}
+
+static void shouldDecodeNegativeDht22Temperature() {
+    /* given */
+    DhtFrameDecoder decoder{};
+    /* 10.1 %, -10.1 °C */
+    uint8_t frame[5] = {0x00, 0x65, 0x80, 0x65, 0x4A};
+
+    /* when */
+    feedFrame(decoder, frame, 0);
+
+    /* then */
+    assert(decoder.decode() == DhtReadStatus::Ok);
+    assert(decoder.getHumidityDeci(DhtModel::Am2302) == 101);
+    assert(decoder.getTemperatureDeci(DhtModel::Am2302) == -101);
+
+    std::cout << "ok -> shouldDecodeNegativeDht22Temperature\n";
+}
+
+static void shouldDecodeDht11Frame() {
+    /* given */
+    DhtFrameDecoder decoder{};
+    /* 45 %, 23.4 °C */
+    uint8_t frame[5] = {45, 0, 23, 4, 72};
+
+    /* when */
+    feedFrame(decoder, frame, 0);
+
+    /* then */
+    assert(decoder.decode() == DhtReadStatus::Ok);
+    assert(decoder.getHumidityDeci(DhtModel::Dht11) == 450);
+    assert(decoder.getTemperatureDeci(DhtModel::Dht11) == 234);
+
+    std::cout << "ok -> shouldDecodeDht11Frame\n";
+}
+
+static void shouldDecodeFrameAcrossMicrosOverflow() {
+    /* given */
+    DhtFrameDecoder decoder{};
+    uint8_t frame[5] = {0x02, 0x8C, 0x01, 0x5F, 0xEE};
+
+    /* when */
+    feedFrame(decoder, frame, 65535 - 2000);
+
+    /* then */
+    assert(decoder.decode() == DhtReadStatus::Ok);
+    assert(decoder.getTemperatureDeci(DhtModel::Dht22) == 351);
+
+    std::cout << "ok -> shouldDecodeFrameAcrossMicrosOverflow\n";
+}
+
+static void shouldReportChecksumMismatch() {
+    /* given */
+    DhtFrameDecoder decoder{};
+    uint8_t frame[5] = {0x02, 0x8C, 0x01, 0x5F, 0xEF};
+
+    /* when */
+    feedFrame(decoder, frame, 0);
+
+    /* then */
+    assert(decoder.decode() == DhtReadStatus::ChecksumMismatch);
+
+    std::cout << "ok -> shouldReportChecksumMismatch\n";
+}
+
+static void shouldReportMissingAndIncompleteFrame() {
+    /* given */
+    DhtFrameDecoder decoder{};
+
+    /* then */
+    assert(decoder.decode() == DhtReadStatus::NoResponse);
+
+    /* when */
+    decoder.onFallingEdge(0);
+    decoder.onFallingEdge(160);
+    decoder.onFallingEdge(238);
+
+    /* then */
+    assert(!decoder.isComplete());
+    assert(decoder.decode() == DhtReadStatus::Incomplete);
+
+    std::cout << "ok -> shouldReportMissingAndIncompleteFrame\n";
+}
+
+static void shouldReportBadTiming() {
+    /* given */
+    DhtFrameDecoder decoder{};
+    uint16_t us = 0;
+    decoder.onFallingEdge(us);
+    us += 160;
+    decoder.onFallingEdge(us);
+
+    /* when */
+    for (uint8_t bit = 0; bit < 40; ++bit) {
+        us += bit == 20 ? 20 : 78; // <- glitch
+        decoder.onFallingEdge(us);
+    }
+
+    /* then */
+    assert(decoder.decode() == DhtReadStatus::BadTiming);
+
+    std::cout << "ok -> shouldReportBadTiming\n";
+}
+
+static void shouldIgnoreEdgesAfterCompleteFrame() {
+    /* given */
+    DhtFrameDecoder decoder{};
+    uint8_t frame[5] = {0x02, 0x8C, 0x01, 0x5F, 0xEE};
+    feedFrame(decoder, frame, 0);
+
+    /* when */
+    decoder.onFallingEdge(12345);
+
+    /* then */
+    assert(decoder.getEdgeCount() == DhtFrameDecoder::frameEdges);
+    assert(decoder.decode() == DhtReadStatus::Ok);
+
+    std::cout << "ok -> shouldIgnoreEdgesAfterCompleteFrame\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldDecodeDht22Frame();
+        shouldDecodeNegativeDht22Temperature();
+        shouldDecodeDht11Frame();
+        shouldDecodeFrameAcrossMicrosOverflow();
+        shouldReportChecksumMismatch();
+        shouldReportMissingAndIncompleteFrame();
+        shouldReportBadTiming();
+        shouldIgnoreEdgesAfterCompleteFrame();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+#define __TEST_MODE__
+
+#include <cassert>
+#include <iostream>
+#include <chrono>
+
+#include <Common/Sensor.h>
+#include <Common/MulticastForwarder.h>
+
+class MockConsumer : public IForwarder<int> {
+
+public:
+
+    mutable int lastData = 0;
+    mutable int forwardCount = 0;
+
+    void forward(int const &data) const override {
+        lastData = data;
+        ++forwardCount;
+    }
+};
+
+static void shouldForwardReadingToAllAttachedForwarders() {
+    /* given */
+    MockConsumer display{};
+    MockConsumer logger{};
+    MockConsumer station{};
+
+    MulticastForwarder<int, 3> multicastForwarder{};
+    multicastForwarder.attach(display);
+    multicastForwarder.attach(logger);
+    multicastForwarder.attach(station);
+
+    Sensor<int> sensor{&multicastForwarder, 0};
+
+    /* when */
+    sensor.setReading(27);
+
+    /* then */
+    assert(display.lastData == 27);
+    assert(logger.lastData == 27);
+    assert(station.lastData == 27);
+    assert(display.forwardCount == 1);
+    assert(logger.forwardCount == 1);
+    assert(station.forwardCount == 1);
+
+    std::cout << "ok -> shouldForwardReadingToAllAttachedForwarders\n";
+}
+
+static void shouldNotAttachMoreThanCapacity() {
+    /* given */
+    MockConsumer first{};
+    MockConsumer second{};
+    MockConsumer third{};
+
+    MulticastForwarder<int, 2> multicastForwarder{};
+    assert(multicastForwarder.isEmpty());
+
+    /* when */
+    assert(multicastForwarder.attach(first));
+    assert(multicastForwarder.attach(second));
+
+    /* then */
+    assert(multicastForwarder.isFull());
+    assert(!multicastForwarder.attach(third));
+    assert(multicastForwarder.size() == 2);
+
+    multicastForwarder.forward(5);
+    assert(third.forwardCount == 0);
+
+    std::cout << "ok -> shouldNotAttachMoreThanCapacity\n";
+}
+
+static void shouldNotAttachTheSameForwarderTwice() {
+    /* given */
+    MockConsumer consumer{};
+    MulticastForwarder<int, 2> multicastForwarder{};
+
+    /* when */
+    assert(multicastForwarder.attach(consumer));
+    assert(!multicastForwarder.attach(consumer));
+
+    /* then */
+    multicastForwarder.forward(5);
+    assert(multicastForwarder.size() == 1);
+    assert(consumer.forwardCount == 1);
+
+    std::cout << "ok -> shouldNotAttachTheSameForwarderTwice\n";
+}
+
+static void shouldStopForwardingToDetachedForwarder() {
+    /* given */
+    MockConsumer first{};
+    MockConsumer second{};
+    MockConsumer third{};
+
+    MulticastForwarder<int, 3> multicastForwarder{};
+    multicastForwarder.attach(first);
+    multicastForwarder.attach(second);
+    multicastForwarder.attach(third);
+
+    /* when */
+    assert(multicastForwarder.detach(second));
+    assert(!multicastForwarder.detach(second));
+    multicastForwarder.forward(11);
+
+    /* then */
+    assert(multicastForwarder.size() == 2);
+    assert(!multicastForwarder.contains(second));
+    assert(first.lastData == 11);
+    assert(second.forwardCount == 0);
+    assert(third.lastData == 11);
+
+    std::cout << "ok -> shouldStopForwardingToDetachedForwarder\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldForwardReadingToAllAttachedForwarders();
+        shouldNotAttachMoreThanCapacity();
+        shouldNotAttachTheSameForwarderTwice();
+        shouldStopForwardingToDetachedForwarder();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include <cassert>
+#include <iostream>
+#include <chrono>
+
+#include <Common/OversamplingAccumulator.h>
+
+static void shouldPassSamplesThroughWithoutExtraBits() {
+    /* given */
+    OversamplingAccumulator accumulator{0};
+
+    /* when */
+    bool isFinished = accumulator.add(512);
+
+    /* then */
+    assert(isFinished);
+    assert(accumulator.getSamplesPerValue() == 1);
+    assert(accumulator.getValue() == 512);
+    assert(accumulator.getSequence() == 1);
+
+    std::cout << "ok -> shouldPassSamplesThroughWithoutExtraBits\n";
+}
+
+static void shouldFinishValueAfterFourToThePowerOfExtraBitsSamples() {
+    /* given */
+    OversamplingAccumulator accumulator{2};
+    assert(!accumulator.hasValue());
+
+    /* when */
+    for (uint8_t i = 0; i < 15; ++i) {
+        assert(!accumulator.add(100));
+    }
+
+    /* then */
+    assert(!accumulator.hasValue());
+    assert(accumulator.add(100));
+    assert(accumulator.hasValue());
+
+    std::cout << "ok -> shouldFinishValueAfterFourToThePowerOfExtraBitsSamples\n";
+}
+
+static void shouldGainResolutionFromNoisySamples() {
+    /* given */
+    OversamplingAccumulator accumulator{2};
+
+    /* when, true value 100.25 LSB dithered between 100 and 101 */
+    for (uint8_t i = 0; i < 16; ++i) {
+        accumulator.add(i % 4 == 0 ? 101 : 100);
+    }
+
+    /* then, 12-bit result */
+    assert(accumulator.getValue() == 401);
+
+    std::cout << "ok -> shouldGainResolutionFromNoisySamples\n";
+}
+
+static void shouldHoldFullScaleWithMaxExtraBits() {
+    /* given */
+    OversamplingAccumulator accumulator{OversamplingAccumulator::maxExtraBits + 1};
+    assert(accumulator.getExtraBits() == OversamplingAccumulator::maxExtraBits);
+
+    /* when */
+    for (uint16_t i = 0; i < accumulator.getSamplesPerValue(); ++i) {
+        accumulator.add(1023);
+    }
+
+    /* then, 16-bit result */
+    assert(accumulator.getValue() == 1023u << OversamplingAccumulator::maxExtraBits);
+
+    std::cout << "ok -> shouldHoldFullScaleWithMaxExtraBits\n";
+}
+
+static void shouldNeverReturnToZeroSequence() {
+    /* given */
+    OversamplingAccumulator accumulator{0};
+
+    /* when */
+    for (uint16_t i = 0; i < 300; ++i) {
+        accumulator.add(1);
+        assert(accumulator.getSequence() != 0);
+    }
+
+    /* then */
+    assert(accumulator.getSequence() == 300 - 255);
+
+    std::cout << "ok -> shouldNeverReturnToZeroSequence\n";
+}
+
+static void shouldDiscardPartialSumOnExtraBitsChange() {
+    /* given */
+    OversamplingAccumulator accumulator{1};
+    accumulator.add(1000);
+    accumulator.add(1000);
+
+    /* when */
+    accumulator.setExtraBits(0);
+
+    /* then */
+    assert(accumulator.add(7));
+    assert(accumulator.getValue() == 7);
+
+    std::cout << "ok -> shouldDiscardPartialSumOnExtraBitsChange\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldPassSamplesThroughWithoutExtraBits();
+        shouldFinishValueAfterFourToThePowerOfExtraBitsSamples();
+        shouldGainResolutionFromNoisySamples();
+        shouldHoldFullScaleWithMaxExtraBits();
+        shouldNeverReturnToZeroSequence();
+        shouldDiscardPartialSumOnExtraBitsChange();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
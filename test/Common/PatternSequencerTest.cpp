@@ -0,0 +1,156 @@
+#define __TEST_MODE__
+
+#include <assert.h>
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+
+#include "../_Mocks/MockCommon.h"
+
+#include <Abstract/AbstractRunnable.h>
+#include <Abstract/AbstractPatternSequencer.h>
+
+/**
+ * <br/>
+ * Counts the port updates.
+ */
+class MockPatternSequencer :
+        public AbstractPatternSequencer {
+
+public:
+
+    uint8_t port = 0;
+    uint32_t writeCount = 0;
+
+    void setup() override {}
+
+protected:
+
+    void writeOutputs(uint8_t const outputs) override {
+        port = outputs;
+        ++writeCount;
+    }
+};
+
+static void loop() {
+    AbstractRunnable::loopAll();
+}
+
+static void loop(uint32_t forwardMs) {
+    for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+        loop();
+    }
+}
+
+static void shouldPlayPatternStepByStep() {
+    /* given */
+    MockPatternSequencer sequencer{};
+    sequencer.setPattern(0, Pattern::Flash);
+    uint32_t onMs = 0;
+
+    /* when */
+    for (uint32_t ms = 0; ms < 2 * 2560; ++ms) {
+        loop();
+        if (sequencer.port & 0x01u) {
+            ++onMs;
+        }
+    }
+
+    /* then, 80 ms once per 2560 ms */
+    assert(onMs == 2 * 80);
+
+    std::cout << "ok -> shouldPlayPatternStepByStep\n";
+}
+
+static void shouldWriteAllChannelsInOneUpdate() {
+    /* given */
+    MockPatternSequencer sequencer{};
+    loop();
+    uint32_t writeCount = sequencer.writeCount;
+
+    /* when */
+    sequencer.setPattern(0, Pattern::On);
+    sequencer.setPattern(1, Pattern::On);
+    sequencer.setPattern(2, Pattern::On);
+    loop();
+
+    /* then */
+    assert(sequencer.port == 0x07u);
+    assert(sequencer.writeCount == writeCount + 1);
+
+    /* when, steady pattern */
+    loop(10000);
+
+    /* then, no writes */
+    assert(sequencer.writeCount == writeCount + 1);
+
+    std::cout << "ok -> shouldWriteAllChannelsInOneUpdate\n";
+}
+
+static void shouldKeepBlinkingInPhase() {
+    /* given */
+    MockPatternSequencer sequencer{};
+    sequencer.setPattern(0, Pattern::SlowBlink);
+    loop(1234);
+
+    /* when, second channel and second sequencer start later */
+    sequencer.setPattern(1, Pattern::SlowBlink);
+    MockPatternSequencer lateSequencer{};
+    lateSequencer.setPattern(0, Pattern::SlowBlink);
+
+    /* then */
+    for (uint32_t ms = 0; ms < 3 * 2560; ++ms) {
+        loop();
+        assert(((sequencer.port >> 1u) & 1u) == (sequencer.port & 1u));
+        assert(lateSequencer.port == (sequencer.port & 1u));
+        assert(lateSequencer.getStep() == sequencer.getStep());
+    }
+
+    std::cout << "ok -> shouldKeepBlinkingInPhase\n";
+}
+
+static void shouldLockStepToMillis() {
+    /* given */
+    MockPatternSequencer sequencer{};
+
+    /* when */
+    loop(5000);
+
+    /* then, last processed loop was millis() - 1 */
+    assert(sequencer.getStep() == ((millis() - 1) / PATTERN_SEQUENCER_STEP_MS) % AbstractPatternSequencer::stepCount);
+
+    std::cout << "ok -> shouldLockStepToMillis\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldPlayPatternStepByStep();
+        shouldWriteAllChannelsInOneUpdate();
+        shouldKeepBlinkingInPhase();
+        shouldLockStepToMillis();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
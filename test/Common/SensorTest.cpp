@@ -0,0 +1,164 @@
+#define __TEST_MODE__
+
+#include <cassert>
+#include <iostream>
+#include <chrono>
+
+#include <Common/Sensor.h>
+#include <Enums/ReadingQuality.h>
+
+static void loop(uint32_t forwardMs) {
+    for (uint32_t ms = 0; ms < forwardMs; ++ms) {
+        AbstractRunnable::loopAll();
+    }
+}
+
+static void shouldBeStaleBeforeFirstReading() {
+    /* given */
+    Sensor<float> sensor{-100.0f, 1000};
+
+    /* then */
+    assert(sensor.getQuality() == ReadingQuality::Stale);
+    assert(!sensor.isFresh());
+
+    std::cout << "ok -> shouldBeStaleBeforeFirstReading\n";
+}
+
+static void shouldTimestampReading() {
+    /* given */
+    Sensor<float> sensor{-100.0f, 1000};
+
+    /* when */
+    sensor.setReading(24.5f);
+
+    /* then */
+    assert(sensor.getReadingMs() == millis());
+    assert(sensor.getQuality() == ReadingQuality::Ok);
+    assert(sensor.isFresh());
+
+    std::cout << "ok -> shouldTimestampReading\n";
+}
+
+static void shouldBecomeStaleWhenOlderThanMaxAge() {
+    /* given */
+    Sensor<float> sensor{-100.0f, 1000};
+    sensor.setReading(24.5f);
+
+    /* when */
+    loop(1000);
+
+    /* then */
+    assert(sensor.isFresh());
+
+    /* when */
+    loop(1);
+
+    /* then */
+    assert(sensor.getQuality() == ReadingQuality::Stale);
+    assert(sensor.getReading() == 24.5f);
+
+    /* when */
+    sensor.setReading(24.6f);
+
+    /* then */
+    assert(sensor.isFresh());
+
+    std::cout << "ok -> shouldBecomeStaleWhenOlderThanMaxAge\n";
+}
+
+static void shouldNeverBecomeStaleWithoutMaxAge() {
+    /* given */
+    Sensor<float> sensor{-100.0f};
+    sensor.setReading(24.5f);
+
+    /* when */
+    loop(60 * 1000);
+
+    /* then */
+    assert(sensor.isFresh());
+
+    std::cout << "ok -> shouldNeverBecomeStaleWithoutMaxAge\n";
+}
+
+static void shouldReportErrorUntilNextReading() {
+    /* given */
+    Sensor<float> sensor{-100.0f, 1000};
+    sensor.setReading(24.5f);
+
+    /* when */
+    sensor.setError();
+
+    /* then */
+    assert(sensor.getQuality() == ReadingQuality::Error);
+    assert(sensor.getReading() == 24.5f);
+
+    /* when */
+    loop(2000);
+
+    /* then */
+    assert(sensor.getQuality() == ReadingQuality::Error);
+
+    /* when */
+    sensor.setReading(24.6f);
+
+    /* then */
+    assert(sensor.getQuality() == ReadingQuality::Ok);
+
+    std::cout << "ok -> shouldReportErrorUntilNextReading\n";
+}
+
+static void shouldHandleMillisOverflow() {
+    /* given */
+    timeKeeper.setMillis(UINT32_MAX - 100);
+    Sensor<float> sensor{-100.0f, 1000};
+    sensor.setReading(24.5f);
+
+    /* when */
+    loop(500);
+
+    /* then */
+    assert(sensor.isFresh());
+
+    /* when */
+    loop(501);
+
+    /* then */
+    assert(sensor.getQuality() == ReadingQuality::Stale);
+
+    std::cout << "ok -> shouldHandleMillisOverflow\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldBeStaleBeforeFirstReading();
+        shouldTimestampReading();
+        shouldBecomeStaleWhenOlderThanMaxAge();
+        shouldNeverBecomeStaleWithoutMaxAge();
+        shouldReportErrorUntilNextReading();
+        shouldHandleMillisOverflow();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include <assert.h>
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+
+#include <Common/ToneEnvelope.h>
+
+static uint32_t const timerHz = 16000000ul / 32;
+
+/**
+ * <br/>
+ * Runs the timer for <tt>durationMs</tt>, one <tt>onPeriod()</tt> per tone period, as the overflow interrupt would.
+ */
+static void runTimer(ToneEnvelope &envelope, uint32_t const durationMs) {
+    uint32_t ticks = 0;
+    while (ticks < durationMs * (timerHz / 1000)) {
+        ticks += 2u * envelope.getTop();
+        envelope.onPeriod();
+    }
+}
+
+static void shouldConvertFrequencyToTimerValues() {
+    /* given */
+    ToneEnvelope envelope{timerHz};
+
+    /* when */
+    envelope.start(2000, 2000, 255, 255, 0, false);
+
+    /* then */
+    assert(envelope.getTop() == 125);
+    assert(envelope.getCompare() == 62); // <- 50 % duty
+    assert(envelope.topFor(100) == ToneEnvelope::maxTop);
+    assert(envelope.topFor(60000) == 4);
+    assert(envelope.topFor(0) == ToneEnvelope::maxTop);
+
+    /* when, steady tone */
+    runTimer(envelope, 100);
+
+    /* then */
+    assert(envelope.getTop() == 125);
+    assert(!envelope.onPeriod());
+
+    std::cout << "ok -> shouldConvertFrequencyToTimerValues\n";
+}
+
+static void shouldSweepFrequencyAndVolume() {
+    /* given */
+    ToneEnvelope envelope{timerHz};
+    envelope.start(1000, 4000, 255, 0, 200, false);
+    uint8_t startTop = envelope.getTop();
+
+    /* when */
+    runTimer(envelope, 100);
+
+    /* then, half way */
+    uint8_t middleTop = envelope.getTop();
+    assert(middleTop < startTop);
+    assert(middleTop > envelope.topFor(4000));
+    assert(envelope.getVolume() > 100 && envelope.getVolume() < 155);
+
+    /* when */
+    runTimer(envelope, 150);
+
+    /* then, holds the end values */
+    assert(envelope.getTop() == envelope.topFor(4000));
+    assert(envelope.getVolume() == 0);
+    assert(envelope.getCompare() == 0);
+
+    std::cout << "ok -> shouldSweepFrequencyAndVolume\n";
+}
+
+static void shouldRepeatSweep() {
+    /* given */
+    ToneEnvelope envelope{timerHz};
+    envelope.start(2000, 3000, 255, 255, 50, true);
+    uint8_t lowestTop = ToneEnvelope::maxTop;
+    uint8_t highestTop = 0;
+    uint8_t restartCount = 0;
+    uint8_t lastTop = envelope.getTop();
+
+    /* when */
+    uint32_t ticks = 0;
+    while (ticks < 500ul * (timerHz / 1000)) {
+        ticks += 2u * envelope.getTop();
+        envelope.onPeriod();
+        lowestTop = envelope.getTop() < lowestTop ? envelope.getTop() : lowestTop;
+        highestTop = envelope.getTop() > highestTop ? envelope.getTop() : highestTop;
+        restartCount += envelope.getTop() > lastTop ? 1 : 0;
+        lastTop = envelope.getTop();
+    }
+
+    /* then, 10 chirps of 50 ms, 51 ms with the restart step */
+    assert(lowestTop == envelope.topFor(3000));
+    assert(highestTop == envelope.topFor(2000));
+    assert(restartCount >= 9 && restartCount <= 10);
+
+    /* when */
+    envelope.stop();
+
+    /* then */
+    assert(!envelope.isActive());
+    assert(!envelope.onPeriod());
+
+    std::cout << "ok -> shouldRepeatSweep\n";
+}
+
+int main() {
+
+    std::cout << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << " >> TEST START" << "\n"
+              << "------------------------------------------------------------" << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int repeat = 1;
+
+    for (int i = 0; i < repeat; ++i) {
+
+        shouldConvertFrequencyToTimerValues();
+        shouldSweepFrequencyAndVolume();
+        shouldRepeatSweep();
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+
+    std::cout << "\n"
+                 "------------------------------------------------------------" << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " s\n";
+    std::cout << "------------------------------------------------------------" << "\n"
+              << " >> TEST END" << "\n"
+              << "------------------------------------------------------------" << "\n"
+              << "\n";
+
+    return 0;
+}